@@ -0,0 +1,87 @@
+#include "AabbBatch.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#define AABB_BATCH_WIDTH 8
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AABB_BATCH_WIDTH 4
+#include <emmintrin.h>
+#else
+#define AABB_BATCH_WIDTH 1
+#endif
+
+void HitMask::reset(std::size_t count) {
+    words_.assign((count + 63) / 64, 0);
+}
+
+bool HitMask::any() const {
+    for (std::uint64_t word : words_) {
+        if (word) return true;
+    }
+    return false;
+}
+
+void AabbBatch::clear() {
+    minX_.clear();
+    minY_.clear();
+    maxX_.clear();
+    maxY_.clear();
+}
+
+void AabbBatch::push(const sf::FloatRect& box) {
+    minX_.push_back(box.left);
+    minY_.push_back(box.top);
+    maxX_.push_back(box.left + box.width);
+    maxY_.push_back(box.top + box.height);
+}
+
+void AabbBatch::intersect(const sf::FloatRect& query, HitMask& hits) const {
+    const std::size_t count = size();
+    hits.reset(count);
+    std::uint64_t* words = hits.data();
+
+    const float queryMinX = query.left;
+    const float queryMinY = query.top;
+    const float queryMaxX = query.left + query.width;
+    const float queryMaxY = query.top + query.height;
+    std::size_t i = 0;
+
+    // Overlap is max(mins) < min(maxes) on both axes. The lane width divides
+    // 64, so a group of lanes never straddles two mask words.
+#if AABB_BATCH_WIDTH == 8
+    const __m256 qMinX = _mm256_set1_ps(queryMinX);
+    const __m256 qMinY = _mm256_set1_ps(queryMinY);
+    const __m256 qMaxX = _mm256_set1_ps(queryMaxX);
+    const __m256 qMaxY = _mm256_set1_ps(queryMaxY);
+    for (; i + 8 <= count; i += 8) {
+        __m256 overlapX = _mm256_cmp_ps(_mm256_max_ps(_mm256_loadu_ps(&minX_[i]), qMinX),
+            _mm256_min_ps(_mm256_loadu_ps(&maxX_[i]), qMaxX), _CMP_LT_OQ);
+        __m256 overlapY = _mm256_cmp_ps(_mm256_max_ps(_mm256_loadu_ps(&minY_[i]), qMinY),
+            _mm256_min_ps(_mm256_loadu_ps(&maxY_[i]), qMaxY), _CMP_LT_OQ);
+        std::uint64_t lanes = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY)));
+        words[i >> 6] |= lanes << (i & 63);
+    }
+#elif AABB_BATCH_WIDTH == 4
+    const __m128 qMinX = _mm_set1_ps(queryMinX);
+    const __m128 qMinY = _mm_set1_ps(queryMinY);
+    const __m128 qMaxX = _mm_set1_ps(queryMaxX);
+    const __m128 qMaxY = _mm_set1_ps(queryMaxY);
+    for (; i + 4 <= count; i += 4) {
+        __m128 overlapX = _mm_cmplt_ps(_mm_max_ps(_mm_loadu_ps(&minX_[i]), qMinX),
+            _mm_min_ps(_mm_loadu_ps(&maxX_[i]), qMaxX));
+        __m128 overlapY = _mm_cmplt_ps(_mm_max_ps(_mm_loadu_ps(&minY_[i]), qMinY),
+            _mm_min_ps(_mm_loadu_ps(&maxY_[i]), qMaxY));
+        std::uint64_t lanes = static_cast<std::uint32_t>(_mm_movemask_ps(_mm_and_ps(overlapX, overlapY)));
+        words[i >> 6] |= lanes << (i & 63);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        bool overlapX = std::max(minX_[i], queryMinX) < std::min(maxX_[i], queryMaxX);
+        bool overlapY = std::max(minY_[i], queryMinY) < std::min(maxY_[i], queryMaxY);
+        if (overlapX && overlapY) {
+            words[i >> 6] |= std::uint64_t(1) << (i & 63);
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One bit per box, set where the box touched the query
+class HitMask {
+public:
+    // Clears the mask and sizes it for count boxes
+    void reset(std::size_t count);
+
+    bool test(std::size_t index) const { return (words_[index >> 6] >> (index & 63)) & 1u; }
+    bool any() const;
+
+    std::uint64_t* data() { return words_.data(); }
+
+private:
+    std::vector<std::uint64_t> words_;
+};
+
+// Boxes stored as packed min/max arrays so many of them can be tested against
+// one query per instruction (AVX2 or SSE2 where available). Storage is kept
+// between clear() calls, so refilling it every tick does not allocate.
+class AabbBatch {
+public:
+    void clear();
+    void push(const sf::FloatRect& box);
+    std::size_t size() const { return minX_.size(); }
+
+    // Sets bit i of hits where box i overlaps query, with the same strict test
+    // as sf::FloatRect::intersects
+    void intersect(const sf::FloatRect& query, HitMask& hits) const;
+
+private:
+    std::vector<float> minX_;
+    std::vector<float> minY_;
+    std::vector<float> maxX_;
+    std::vector<float> maxY_;
+};
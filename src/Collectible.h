@@ -56,11 +56,12 @@ private:
 
 #pragma once
 
-#include <SFML/Graphics.hpp>
-#include "Animation.h"
-#include "ResourceManager.h"
+#include "TraitTable.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
-enum class CollectibleType {
+enum class CollectibleType : std::uint8_t {
     Coin,
     Gem,
     Candy,
@@ -69,45 +70,62 @@ enum class CollectibleType {
     Shield,
     SpeedBoost,
     DoublePoints,
-    ExtraLife  // ADD THIS LINE
+    ExtraLife,  // ADD THIS LINE
+    Count
 };
 
-class Collectible {
-public:
-    Collectible(const sf::Vector2f& position, CollectibleType type);
-
-    void update(float deltaTime);
-    void render(sf::RenderWindow& window);
-
-    sf::FloatRect getBounds() const;
-    sf::Vector2f getPosition() const;
-
-    bool isCollected() const;
-    void collect();
-
-    CollectibleType getType() const;
-    int getPoints() const;
-
-    bool isActive() const;
-    void setActive(bool active);
-    bool isPowerUp() const;
-    void attractTowards(const sf::Vector2f& target, float strength, float deltaTime);
-    void setPosition(const sf::Vector2f& position);
-
-private:
-    void loadAnimation();
-    std::string getTextureName() const;
+constexpr std::size_t kCollectibleTypeCount = static_cast<std::size_t>(CollectibleType::Count);
 
-    sf::Sprite sprite_;
-    sf::Vector2f position_;
-    CollectibleType type_;
-    bool collected_;
-    bool active_;
+struct CollectibleSnapshot {
+    float x = 0.0f;
+    float y = 0.0f;
+    float vx = 0.0f;
+    float vy = 0.0f;
+    float phase = 0.0f;  // bob phase at world time 0
+    CollectibleType type = CollectibleType::Coin;
+};
 
-    Animation anim_;
-    float floatOffset_;
-    float floatTime_;
-    sf::Vector2f velocity_;
+// What picking up a power-up does; duration and strength come from the traits
+enum class PowerUpEffect : std::uint8_t {
+    None,
+    Magnet,
+    Shield,
+    SpeedBoost,
+    DoublePoints
 };
 
+struct CollectibleTraits {
+    CollectibleType type;
+    const char* textureName;
+    float scale;
+    int points;
+    bool powerUp;
+    PowerUpEffect effect;
+    float duration;  // seconds the effect lasts
+    float strength;  // speed multiplier for SpeedBoost
+};
 
+// Per-type properties, indexed by CollectibleType. Live collectibles are
+// stored in CollectibleField.
+inline constexpr std::array<CollectibleTraits, kCollectibleTypeCount> kCollectibleTraits = { {
+    { CollectibleType::Coin,         "carrot",          0.6f,  10, false, PowerUpEffect::None,         0.0f,  0.0f },  // basic carrot
+    { CollectibleType::Gem,          "carrot_gold",     0.6f,  25, false, PowerUpEffect::None,         0.0f,  0.0f },  // golden carrot
+    { CollectibleType::Candy,        "mushroom_red",    0.6f,   5, false, PowerUpEffect::None,         0.0f,  0.0f },
+    { CollectibleType::Heart,        "coin_gold",       0.6f,  10, false, PowerUpEffect::None,         0.0f,  0.0f },
+    { CollectibleType::Magnet,       "powerup_bunny",   0.85f,  0, true,  PowerUpEffect::Magnet,       10.0f, 0.0f },
+    { CollectibleType::Shield,       "powerup_bubble",  0.85f,  0, true,  PowerUpEffect::Shield,       8.0f,  0.0f },
+    { CollectibleType::SpeedBoost,   "powerup_jetpack", 0.85f,  0, true,  PowerUpEffect::SpeedBoost,   5.0f,  2.0f },
+    { CollectibleType::DoublePoints, "powerup_wings",   0.85f,  0, true,  PowerUpEffect::DoublePoints, 15.0f, 0.0f },
+    { CollectibleType::ExtraLife,    "lifes",           0.7f,   0, true,  PowerUpEffect::None,         0.0f,  0.0f },
+} };
+
+static_assert(coversEveryValue(kCollectibleTraits), "kCollectibleTraits must have one entry per CollectibleType, in enum order");
+
+constexpr const CollectibleTraits& collectibleTraits(CollectibleType type) {
+    return kCollectibleTraits[static_cast<std::size_t>(type)];
+}
+
+constexpr const char* getCollectibleTextureName(CollectibleType type) { return collectibleTraits(type).textureName; }
+constexpr float getCollectibleScale(CollectibleType type) { return collectibleTraits(type).scale; }
+constexpr int getCollectiblePoints(CollectibleType type) { return collectibleTraits(type).points; }
+constexpr bool isPowerUpType(CollectibleType type) { return collectibleTraits(type).powerUp; }
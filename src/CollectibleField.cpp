@@ -0,0 +1,260 @@
+#include "CollectibleField.h"
+#include "ResourceManager.h"
+#include "Kinematics.h"
+#include <array>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COLLECTIBLES_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define COLLECTIBLES_USE_SSE2 0
+#endif
+
+namespace {
+    const float kPi = 3.14159265f;
+    const float kTwoPi = 6.28318531f;
+    const float kBobSpeed = 2.0f;    // radians per second
+    const float kBobWavelength = 240.0f;  // pixels along x per bob cycle
+    const float kBobHeight = 10.0f;
+    const float kDamping = 0.9f;     // per update, as before
+    const std::size_t kTypeCount = kCollectibleTypeCount;
+
+    // Parabola fit refined once; max error about 0.001 on [-pi, pi]
+    const float kSinB = 4.0f / kPi;
+    const float kSinC = -4.0f / (kPi * kPi);
+    const float kSinP = 0.225f;
+
+    inline float fastSin(float x) {
+        float y = kSinB * x + kSinC * x * std::abs(x);
+        return kSinP * (y * std::abs(y) - y) + y;
+    }
+
+    struct TypeVisual {
+        sf::Sprite sprite;
+        sf::Vector2f size;
+    };
+
+    // One shared sprite per type, built on first use once textures are loaded
+    std::array<TypeVisual, kTypeCount>& typeVisuals() {
+        static std::array<TypeVisual, kTypeCount> visuals = [] {
+            std::array<TypeVisual, kTypeCount> table;
+            auto& rm = ResourceManager::getInstance();
+            for (std::size_t i = 0; i < kTypeCount; ++i) {
+                CollectibleType type = static_cast<CollectibleType>(i);
+                const char* name = getCollectibleTextureName(type);
+                float scale = getCollectibleScale(type);
+                if (rm.hasTexture(name)) {
+                    sf::Texture& texture = rm.getTexture(name);
+                    table[i].sprite.setTexture(texture, true);
+                    table[i].size = sf::Vector2f(texture.getSize()) * scale;
+                }
+                table[i].sprite.setScale(scale, scale);
+            }
+            return table;
+        }();
+        return visuals;
+    }
+
+#if COLLECTIBLES_USE_SSE2
+    inline __m128 absPs(__m128 v) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+
+    inline __m128 fastSinPs(__m128 x) {
+        __m128 y = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kSinB), x),
+            _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(kSinC), x), absPs(x)));
+        __m128 refine = _mm_sub_ps(_mm_mul_ps(y, absPs(y)), y);
+        return _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kSinP), refine), y);
+    }
+#endif
+}
+
+void CollectibleField::reserve(std::size_t count) {
+    x_.reserve(count);
+    y_.reserve(count);
+    vx_.reserve(count);
+    vy_.reserve(count);
+    phase_.reserve(count);
+    bob_.reserve(count);
+    type_.reserve(count);
+    flags_.reserve(count);
+}
+
+void CollectibleField::add(const sf::Vector2f& position, CollectibleType type) {
+    CollectibleSnapshot snapshot;
+    snapshot.x = position.x;
+    snapshot.y = position.y;
+    snapshot.phase = wrapAngle(-kTwoPi * position.x / kBobWavelength);
+    snapshot.type = type;
+    add(snapshot);
+}
+
+void CollectibleField::add(const CollectibleSnapshot& snapshot) {
+    x_.push_back(snapshot.x);
+    y_.push_back(snapshot.y);
+    vx_.push_back(snapshot.vx);
+    vy_.push_back(snapshot.vy);
+    phase_.push_back(snapshot.phase);
+    bob_.push_back(0.0f);
+    type_.push_back(static_cast<std::uint8_t>(snapshot.type));
+    flags_.push_back(isPowerUpType(snapshot.type) ? PowerUp : 0);
+}
+
+void CollectibleField::remove(std::size_t index) {
+    const std::size_t last = x_.size() - 1;
+    x_[index] = x_[last];
+    y_[index] = y_[last];
+    vx_[index] = vx_[last];
+    vy_[index] = vy_[last];
+    phase_[index] = phase_[last];
+    bob_[index] = bob_[last];
+    type_[index] = type_[last];
+    flags_[index] = flags_[last];
+    x_.pop_back();
+    y_.pop_back();
+    vx_.pop_back();
+    vy_.pop_back();
+    phase_.pop_back();
+    bob_.pop_back();
+    type_.pop_back();
+    flags_.pop_back();
+}
+
+void CollectibleField::clear() {
+    x_.clear();
+    y_.clear();
+    vx_.clear();
+    vy_.clear();
+    phase_.clear();
+    bob_.clear();
+    type_.clear();
+    flags_.clear();
+}
+
+void CollectibleField::update(float worldTime, float deltaTime, const MagnetPull& magnet) {
+    const std::size_t count = x_.size();
+    float* x = x_.data();
+    float* y = y_.data();
+    float* vx = vx_.data();
+    float* vy = vy_.data();
+    const float* phase = phase_.data();
+    float* bob = bob_.data();
+
+    const float pull = magnet.active ? magnet.strength * deltaTime : 0.0f;
+    // Each item's phase is its own offset plus this shared one, so the sum
+    // is in [-2pi, 2pi) and one step either way brings it back to [-pi, pi)
+    const float bobBase = wrapAngle(kBobSpeed * worldTime);
+    std::size_t i = 0;
+
+#if COLLECTIBLES_USE_SSE2
+    const __m128 dt4 = _mm_set1_ps(deltaTime);
+    const __m128 targetX4 = _mm_set1_ps(magnet.target.x);
+    const __m128 targetY4 = _mm_set1_ps(magnet.target.y);
+    const __m128 radius4 = _mm_set1_ps(magnet.active ? magnet.radius : 0.0f);
+    const __m128 pull4 = _mm_set1_ps(pull);
+    const __m128 one4 = _mm_set1_ps(1.0f);
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    const __m128 threeHalves4 = _mm_set1_ps(1.5f);
+    const __m128 bobBase4 = _mm_set1_ps(bobBase);
+    const __m128 pi4 = _mm_set1_ps(kPi);
+    const __m128 minusPi4 = _mm_set1_ps(-kPi);
+    const __m128 twoPi4 = _mm_set1_ps(kTwoPi);
+    const __m128 bobHeight4 = _mm_set1_ps(kBobHeight);
+    const __m128 damping4 = _mm_set1_ps(kDamping);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 pvx = _mm_loadu_ps(vx + i);
+        __m128 pvy = _mm_loadu_ps(vy + i);
+
+        // Magnet: items within horizontal reach accelerate towards the target
+        __m128 dx = _mm_sub_ps(targetX4, px);
+        __m128 dy = _mm_sub_ps(targetY4, py);
+        __m128 lengthSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 inverse = _mm_rsqrt_ps(lengthSq);
+        // One Newton step takes rsqrt from 12 to about 22 bits
+        inverse = _mm_mul_ps(inverse, _mm_sub_ps(threeHalves4,
+            _mm_mul_ps(_mm_mul_ps(half4, lengthSq), _mm_mul_ps(inverse, inverse))));
+        __m128 inReach = _mm_and_ps(_mm_cmplt_ps(absPs(dx), radius4), _mm_cmpgt_ps(lengthSq, one4));
+        __m128 scale = _mm_and_ps(inReach, _mm_mul_ps(inverse, pull4));
+        pvx = _mm_add_ps(pvx, _mm_mul_ps(dx, scale));
+        pvy = _mm_add_ps(pvy, _mm_mul_ps(dy, scale));
+
+        // Bob
+        __m128 ph = _mm_add_ps(_mm_loadu_ps(phase + i), bobBase4);
+        ph = _mm_sub_ps(ph, _mm_and_ps(_mm_cmpge_ps(ph, pi4), twoPi4));
+        ph = _mm_add_ps(ph, _mm_and_ps(_mm_cmplt_ps(ph, minusPi4), twoPi4));
+        _mm_storeu_ps(bob + i, _mm_mul_ps(fastSinPs(ph), bobHeight4));
+
+        // Integrate, then damp
+        _mm_storeu_ps(x + i, _mm_add_ps(px, _mm_mul_ps(pvx, dt4)));
+        _mm_storeu_ps(y + i, _mm_add_ps(py, _mm_mul_ps(pvy, dt4)));
+        _mm_storeu_ps(vx + i, _mm_mul_ps(pvx, damping4));
+        _mm_storeu_ps(vy + i, _mm_mul_ps(pvy, damping4));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (magnet.active) {
+            float dx = magnet.target.x - x[i];
+            float dy = magnet.target.y - y[i];
+            float lengthSq = dx * dx + dy * dy;
+            if (std::abs(dx) < magnet.radius && lengthSq > 1.0f) {
+                float scale = pull / std::sqrt(lengthSq);
+                vx[i] += dx * scale;
+                vy[i] += dy * scale;
+            }
+        }
+
+        float ph = phase[i] + bobBase;
+        if (ph >= kPi) ph -= kTwoPi;
+        else if (ph < -kPi) ph += kTwoPi;
+        bob[i] = fastSin(ph) * kBobHeight;
+
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+        vx[i] *= kDamping;
+        vy[i] *= kDamping;
+    }
+}
+
+void CollectibleField::render(sf::RenderWindow& window) const {
+    auto& visuals = typeVisuals();
+    for (std::size_t i = 0; i < x_.size(); ++i) {
+        sf::Sprite& sprite = visuals[type_[i]].sprite;
+        sprite.setPosition(x_[i], y_[i] + bob_[i]);
+        window.draw(sprite);
+    }
+}
+
+sf::FloatRect CollectibleField::getBounds(std::size_t index) const {
+    const sf::Vector2f& size = typeVisuals()[type_[index]].size;
+    return sf::FloatRect(x_[index], y_[index] + bob_[index], size.x, size.y);
+}
+
+sf::Sprite CollectibleField::getSprite(std::size_t index) const {
+    sf::Sprite sprite = typeVisuals()[type_[index]].sprite;
+    sprite.setPosition(x_[index], y_[index] + bob_[index]);
+    return sprite;
+}
+
+void CollectibleField::appendBounds(AabbBatch& batch) const {
+    const auto& visuals = typeVisuals();
+    for (std::size_t i = 0; i < x_.size(); ++i) {
+        const sf::Vector2f& size = visuals[type_[i]].size;
+        batch.push(sf::FloatRect(x_[i], y_[i] + bob_[i], size.x, size.y));
+    }
+}
+
+CollectibleSnapshot CollectibleField::getSnapshot(std::size_t index) const {
+    CollectibleSnapshot snapshot;
+    snapshot.x = x_[index];
+    snapshot.y = y_[index];
+    snapshot.vx = vx_[index];
+    snapshot.vy = vy_[index];
+    snapshot.phase = phase_[index];
+    snapshot.type = getType(index);
+    return snapshot;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "AabbBatch.h"
+#include "Collectible.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct MagnetPull {
+    bool active = false;
+    sf::Vector2f target;
+    float radius = 0.0f;    // horizontal reach
+    float strength = 0.0f;  // px/s^2
+};
+
+// Live collectibles stored as parallel arrays. update() evaluates the bob from
+// world time and advances magnet pull and damping for every item in one pass
+// (SSE2 where available).
+// Collected items are swap-removed, so every stored item is live and indices
+// are only stable until the next remove().
+class CollectibleField {
+public:
+    enum Flags : std::uint8_t {
+        PowerUp = 1 << 0
+    };
+
+    void reserve(std::size_t count);
+    // The bob phase follows world x, so it does not depend on when the item was built
+    void add(const sf::Vector2f& position, CollectibleType type);
+    void add(const CollectibleSnapshot& snapshot);
+    void remove(std::size_t index);
+    void clear();
+
+    void update(float worldTime, float deltaTime, const MagnetPull& magnet);
+    void render(sf::RenderWindow& window) const;
+
+    std::size_t size() const { return x_.size(); }
+    bool empty() const { return x_.empty(); }
+
+    sf::Vector2f getPosition(std::size_t index) const { return sf::Vector2f(x_[index], y_[index]); }
+    sf::FloatRect getBounds(std::size_t index) const;
+    // The sprite the item is drawn with, for pixel-exact hits
+    sf::Sprite getSprite(std::size_t index) const;
+    // Appends every item's bounds to batch, in index order
+    void appendBounds(AabbBatch& batch) const;
+    CollectibleType getType(std::size_t index) const { return static_cast<CollectibleType>(type_[index]); }
+    bool isPowerUp(std::size_t index) const { return (flags_[index] & PowerUp) != 0; }
+    CollectibleSnapshot getSnapshot(std::size_t index) const;
+
+private:
+    std::vector<float> x_;
+    std::vector<float> y_;
+    std::vector<float> vx_;
+    std::vector<float> vy_;
+    std::vector<float> phase_;  // bob phase at world time 0, in [-pi, pi)
+    std::vector<float> bob_;    // vertical bob offset at the last update
+    std::vector<std::uint8_t> type_;
+    std::vector<std::uint8_t> flags_;
+};
@@ -0,0 +1,101 @@
+#include "CollisionMask.h"
+#include "ResourceManager.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    int roundToPixel(float value) {
+        return static_cast<int>(std::floor(value + 0.5f));
+    }
+
+    const CollisionMask* maskOf(const sf::Sprite& sprite) {
+        const sf::Texture* texture = sprite.getTexture();
+        if (!texture) return nullptr;
+        sf::Vector2f scale = sprite.getScale();
+        return ResourceManager::getInstance().getCollisionMask(*texture, scale.x, scale.y);
+    }
+}
+
+CollisionMask::CollisionMask(const sf::Image& image) {
+    sf::Vector2u size = image.getSize();
+    resize(static_cast<int>(size.x), static_cast<int>(size.y));
+    const sf::Uint8* pixels = image.getPixelsPtr();
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            // RGBA, so alpha is every fourth byte
+            if (pixels[(static_cast<std::size_t>(y) * width_ + x) * 4 + 3] >= kAlphaThreshold) {
+                set(x, y);
+            }
+        }
+    }
+}
+
+void CollisionMask::resize(int width, int height) {
+    width_ = width;
+    height_ = height;
+    wordsPerRow_ = (width + 63) / 64;
+    bits_.assign(static_cast<std::size_t>(wordsPerRow_) * height_, 0);
+}
+
+CollisionMask CollisionMask::scaled(float scaleX, float scaleY) const {
+    CollisionMask result;
+    const float absX = std::abs(scaleX);
+    const float absY = std::abs(scaleY);
+    result.resize(std::max(1, roundToPixel(width_ * absX)), std::max(1, roundToPixel(height_ * absY)));
+    if (width_ == 0 || height_ == 0) return result;
+
+    for (int y = 0; y < result.height_; ++y) {
+        int sourceY = std::min(height_ - 1, static_cast<int>((y + 0.5f) / absY));
+        for (int x = 0; x < result.width_; ++x) {
+            int sourceX = std::min(width_ - 1, static_cast<int>((x + 0.5f) / absX));
+            if (scaleX < 0.0f) sourceX = width_ - 1 - sourceX;
+            if (test(sourceX, sourceY)) {
+                result.set(x, y);
+            }
+        }
+    }
+    return result;
+}
+
+std::uint64_t CollisionMask::bitsAt(int x, int y) const {
+    if (y < 0 || y >= height_ || x < 0 || x >= width_) return 0;
+
+    const std::uint64_t* row = &bits_[static_cast<std::size_t>(y) * wordsPerRow_];
+    const int word = x >> 6;
+    const int shift = x & 63;
+    std::uint64_t bits = row[word] >> shift;
+    if (shift != 0 && word + 1 < wordsPerRow_) {
+        bits |= row[word + 1] << (64 - shift);
+    }
+    return bits;
+}
+
+bool masksOverlap(const CollisionMask& a, const sf::Vector2i& originA,
+    const CollisionMask& b, const sf::Vector2i& originB) {
+    const int left = std::max(originA.x, originB.x);
+    const int right = std::min(originA.x + a.getWidth(), originB.x + b.getWidth());
+    const int top = std::max(originA.y, originB.y);
+    const int bottom = std::min(originA.y + a.getHeight(), originB.y + b.getHeight());
+    if (left >= right || top >= bottom) return false;
+
+    for (int y = top; y < bottom; ++y) {
+        for (int x = left; x < right; x += 64) {
+            std::uint64_t overlap = a.bitsAt(x - originA.x, y - originA.y) & b.bitsAt(x - originB.x, y - originB.y);
+            // The last group of a row may reach past the overlap
+            const int span = right - x;
+            if (span < 64) overlap &= (std::uint64_t(1) << span) - 1;
+            if (overlap) return true;
+        }
+    }
+    return false;
+}
+
+bool spritesOverlap(const sf::Sprite& a, const sf::Sprite& b) {
+    const sf::FloatRect boundsA = a.getGlobalBounds();
+    const sf::FloatRect boundsB = b.getGlobalBounds();
+    const CollisionMask* maskA = maskOf(a);
+    const CollisionMask* maskB = maskOf(b);
+    if (!maskA || !maskB) return boundsA.intersects(boundsB);
+    return masksOverlap(*maskA, sf::Vector2i(roundToPixel(boundsA.left), roundToPixel(boundsA.top)),
+        *maskB, sf::Vector2i(roundToPixel(boundsB.left), roundToPixel(boundsB.top)));
+}
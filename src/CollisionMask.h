@@ -0,0 +1,45 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Opaque pixels of an image, one bit per pixel. Each row is packed into
+// 64-bit words, pixel x in bit (x % 64) of word (x / 64).
+class CollisionMask {
+public:
+    static constexpr std::uint8_t kAlphaThreshold = 128;
+
+    CollisionMask() = default;
+    explicit CollisionMask(const sf::Image& image);
+
+    // Nearest-neighbour copy at a new size; a negative scaleX mirrors it
+    CollisionMask scaled(float scaleX, float scaleY) const;
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+
+    // 64 pixels of row y starting at column x >= 0; pixels past the edge are clear
+    std::uint64_t bitsAt(int x, int y) const;
+
+private:
+    void resize(int width, int height);
+    void set(int x, int y) { bits_[y * wordsPerRow_ + (x >> 6)] |= std::uint64_t(1) << (x & 63); }
+    bool test(int x, int y) const { return (bits_[y * wordsPerRow_ + (x >> 6)] >> (x & 63)) & 1u; }
+
+    int width_ = 0;
+    int height_ = 0;
+    int wordsPerRow_ = 0;
+    std::vector<std::uint64_t> bits_;
+};
+
+// Whether two masks share an opaque pixel with their top-left corners at
+// the given world pixels. Rows are compared 64 pixels per AND.
+bool masksOverlap(const CollisionMask& a, const sf::Vector2i& originA,
+    const CollisionMask& b, const sf::Vector2i& originB);
+
+// Narrow phase for two unrotated sprites that show their whole texture.
+// If either texture did not come from ResourceManager it has no mask, and
+// the sprites' boxes are compared instead.
+bool spritesOverlap(const sf::Sprite& a, const sf::Sprite& b);
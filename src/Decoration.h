@@ -0,0 +1,48 @@
+#pragma once
+
+#include "TraitTable.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class DecorationKind : std::uint8_t {
+    Cactus,
+    RedMushroom,
+    BrownMushroom,
+    Spring,
+    Count
+};
+
+constexpr std::size_t kDecorationKindCount = static_cast<std::size_t>(DecorationKind::Count);
+
+// What touching a decoration does to the player
+enum class DecorationBehavior : std::uint8_t {
+    None,
+    Damage,        // costs a life
+    ScorePenalty   // costs `penalty` points, never below 0
+};
+
+struct DecorationTraits {
+    DecorationKind type;
+    const char* textureName;
+    DecorationBehavior behavior;
+    int penalty;
+    float hitbox[4];  // left, top, width, height as fractions of the drawn size
+};
+
+// Per-kind properties, indexed by DecorationKind. Live decorations are
+// stored in DecorationStore.
+inline constexpr std::array<DecorationTraits, kDecorationKindCount> kDecorationTraits = { {
+    { DecorationKind::Cactus,        "cactus",         DecorationBehavior::Damage,       0,  { 0.1f, 0.05f, 0.8f, 0.95f } },
+    { DecorationKind::RedMushroom,   "mushroom_red",   DecorationBehavior::None,         0,  { 0.0f, 0.0f,  1.0f, 1.0f } },   // safe
+    { DecorationKind::BrownMushroom, "decor_mushroom", DecorationBehavior::ScorePenalty, 15, { 0.1f, 0.1f,  0.8f, 0.9f } },
+    { DecorationKind::Spring,        "spring",         DecorationBehavior::None,         0,  { 0.0f, 0.0f,  1.0f, 1.0f } },   // the platform does the bounce
+} };
+
+static_assert(coversEveryValue(kDecorationTraits), "kDecorationTraits must have one entry per DecorationKind, in enum order");
+
+constexpr const DecorationTraits& decorationTraits(DecorationKind kind) {
+    return kDecorationTraits[static_cast<std::size_t>(kind)];
+}
+
+constexpr const char* decorationTextureName(DecorationKind kind) { return decorationTraits(kind).textureName; }
@@ -0,0 +1,96 @@
+#include "DecorationStore.h"
+#include "ResourceManager.h"
+#include <algorithm>
+
+namespace {
+    struct KindVisual {
+        sf::Sprite sprite;
+        sf::Vector2f size;  // unscaled texture size
+    };
+
+    // One shared sprite per kind, built on first use once textures are loaded
+    std::array<KindVisual, kDecorationKindCount>& kindVisuals() {
+        static std::array<KindVisual, kDecorationKindCount> visuals = [] {
+            std::array<KindVisual, kDecorationKindCount> table;
+            auto& rm = ResourceManager::getInstance();
+            for (const DecorationTraits& traits : kDecorationTraits) {
+                if (!rm.hasTexture(traits.textureName)) continue;
+                KindVisual& visual = table[static_cast<std::size_t>(traits.type)];
+                sf::Texture& texture = rm.getTexture(traits.textureName);
+                visual.sprite.setTexture(texture, true);
+                visual.size = sf::Vector2f(texture.getSize());
+            }
+            return table;
+        }();
+        return visuals;
+    }
+
+    template <typename T>
+    void eraseFront(std::vector<T>& values, std::size_t count) {
+        values.erase(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+}
+
+void DecorationStore::add(DecorationKind kind, const sf::Vector2f& position, float scale) {
+    const std::size_t index = static_cast<std::size_t>(std::upper_bound(x_.begin(), x_.end(), position.x) - x_.begin());
+    const auto at = static_cast<std::ptrdiff_t>(index);
+    x_.insert(x_.begin() + at, position.x);
+    y_.insert(y_.begin() + at, position.y);
+    scale_.insert(scale_.begin() + at, scale);
+    kind_.insert(kind_.begin() + at, static_cast<std::uint8_t>(kind));
+    maxWidth_ = std::max(maxWidth_, kindVisuals()[kind_[index]].size.x * scale);
+}
+
+void DecorationStore::trimBefore(float x) {
+    const auto& visuals = kindVisuals();
+    std::size_t count = 0;
+    while (count < x_.size() && x_[count] + visuals[kind_[count]].size.x * scale_[count] < x) {
+        ++count;
+    }
+    if (count == 0) return;
+    eraseFront(x_, count);
+    eraseFront(y_, count);
+    eraseFront(scale_, count);
+    eraseFront(kind_, count);
+}
+
+void DecorationStore::clear() {
+    x_.clear();
+    y_.clear();
+    scale_.clear();
+    kind_.clear();
+    maxWidth_ = 0.0f;
+}
+
+std::pair<std::size_t, std::size_t> DecorationStore::range(float left, float right) const {
+    // Anything starting further left than the widest decoration cannot reach left
+    auto first = std::lower_bound(x_.begin(), x_.end(), left - maxWidth_);
+    auto last = std::lower_bound(first, x_.end(), right);
+    return { static_cast<std::size_t>(first - x_.begin()), static_cast<std::size_t>(last - x_.begin()) };
+}
+
+sf::FloatRect DecorationStore::getBounds(std::size_t index) const {
+    const DecorationTraits& traits = decorationTraits(getKind(index));
+    const sf::Vector2f size = kindVisuals()[kind_[index]].size * scale_[index];
+    return sf::FloatRect(x_[index] + traits.hitbox[0] * size.x, y_[index] + traits.hitbox[1] * size.y,
+        traits.hitbox[2] * size.x, traits.hitbox[3] * size.y);
+}
+
+sf::Sprite DecorationStore::getSprite(std::size_t index) const {
+    sf::Sprite sprite = kindVisuals()[kind_[index]].sprite;
+    sprite.setScale(scale_[index], scale_[index]);
+    sprite.setPosition(x_[index], y_[index]);
+    return sprite;
+}
+
+void DecorationStore::render(sf::RenderWindow& window, float left, float right) const {
+    auto& visuals = kindVisuals();
+    const auto visible = range(left, right);
+    for (std::size_t i = visible.first; i < visible.second; ++i) {
+        sf::Sprite& sprite = visuals[kind_[i]].sprite;
+        if (!sprite.getTexture()) continue;
+        sprite.setScale(scale_[i], scale_[i]);
+        sprite.setPosition(x_[i], y_[i]);
+        window.draw(sprite);
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Decoration.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Materialized decorations, kept sorted by x as parallel arrays.
+// Decorations never move, so the ones near a point are a binary search
+// away, and trimBefore() drops everything the camera has passed.
+class DecorationStore {
+public:
+    // Decorations arrive in x order, so this is almost always an append
+    void add(DecorationKind kind, const sf::Vector2f& position, float scale);
+    // Drops decorations that end left of x
+    void trimBefore(float x);
+    void clear();
+
+    std::size_t size() const { return x_.size(); }
+
+    // Index range [first, second) of the decorations that may overlap [left, right)
+    std::pair<std::size_t, std::size_t> range(float left, float right) const;
+
+    DecorationKind getKind(std::size_t index) const { return static_cast<DecorationKind>(kind_[index]); }
+    sf::Vector2f getPosition(std::size_t index) const { return sf::Vector2f(x_[index], y_[index]); }
+    float getScale(std::size_t index) const { return scale_[index]; }
+    // Hitbox from the kind's traits
+    sf::FloatRect getBounds(std::size_t index) const;
+    // The sprite the decoration is drawn with, for pixel-exact hits
+    sf::Sprite getSprite(std::size_t index) const;
+
+    void render(sf::RenderWindow& window, float left, float right) const;
+
+private:
+    std::vector<float> x_;
+    std::vector<float> y_;
+    std::vector<float> scale_;
+    std::vector<std::uint8_t> kind_;
+    float maxWidth_ = 0.0f;  // widest decoration added, for range()
+};
@@ -1,159 +1,222 @@
 #include "Enemy.h"
+#include "Kinematics.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
 
-Enemy::Enemy(const sf::Vector2f& position, EnemyType type, float speed)
-    : position_(position)
-    , target_(position)
-    , speed_(speed)
-    , active_(true)
-    , facingRight_(false)
-    , type_(type)
-    , sineTimer_(0.0f)
-    , shootTimer_(0.0f)
-    , wantsToShoot_(false)
-    , animTimer_(0.0f)
-    , currentFrame_(0) {
-
-    loadAnimation();
-
-    if (!frames_.empty()) {
-        sprite_.setTexture(*frames_[0]);
+namespace {
+    const float kEnemyScale = 0.7f;
+    const float kFrameTime = 0.15f;
+    const float kDespawnX = -200.0f;
+
+    using FrameList = std::vector<const sf::Texture*>;
+
+    // Animation frames per type, looked up once textures are loaded
+    const FrameList& enemyFrames(EnemyType type) {
+        static const std::array<FrameList, kEnemyTypeCount> frames = [] {
+            std::array<FrameList, kEnemyTypeCount> table;
+            auto& rm = ResourceManager::getInstance();
+            for (const EnemyTraits& traits : kEnemyTraits) {
+                FrameList& list = table[static_cast<std::size_t>(traits.type)];
+                for (const char* name : traits.frames) {
+                    if (rm.hasTexture(name)) {
+                        list.push_back(&rm.getTexture(name));
+                    }
+                }
+                if (list.empty() && rm.hasTexture("enemy")) {
+                    list.push_back(&rm.getTexture("enemy"));
+                }
+            }
+            return table;
+        }();
+        return frames[static_cast<std::size_t>(type)];
     }
-    sprite_.setPosition(position_);
-    sprite_.setScale(0.7f, 0.7f);
-}
 
-void Enemy::loadAnimation() {
-    auto& rm = ResourceManager::getInstance();
-    auto pushFrame = [&](const std::string& name) {
-        if (rm.hasTexture(name)) {
-            frames_.push_back(&rm.getTexture(name));
-        }
-        };
+    struct EnemyContext {
+        float worldTime;
+        float deltaTime;
+        sf::Vector2f target;
+        std::vector<sf::Vector2f>* shots;
+        SimulationLod* lod;
+    };
 
-    switch (type_) {
-    case EnemyType::Flyer:
-        pushFrame("flyMan_fly");
-        pushFrame("flyMan_still_fly");
-        break;
-    case EnemyType::Shooter:
-        pushFrame("wingMan1");
-        pushFrame("wingMan2");
-        break;
-    case EnemyType::Chaser:
-        pushFrame("spikeMan_jump");
-        pushFrame("spikeMan_walk1");
-        break;
-    case EnemyType::Walker:
-    default:
-        pushFrame("spikeMan_walk1");
-        pushFrame("spikeMan_walk2");
-        break;
+    float ageOf(const EnemyBody& body, float worldTime) {
+        return std::max(0.0f, worldTime - body.spawnTime);
     }
 
-    if (frames_.empty() && rm.hasTexture("enemy")) {
-        frames_.push_back(&rm.getTexture("enemy"));
+    // Movement kernels, one per type; overload resolution picks them statically
+    // Horizontal position of the types that walk left at a constant speed
+    float driftX(const EnemyBody& body, EnemyType type, float worldTime) {
+        return body.origin.x - body.speed * enemyTraits(type).speedScale * ageOf(body, worldTime);
     }
-}
 
-void Enemy::update(float deltaTime) {
-    if (!active_) return;
-    wantsToShoot_ = false;
+    void step(WalkerEnemy& enemy, const EnemyContext& context) {
+        enemy.body.position.x = driftX(enemy.body, WalkerEnemy::kType, context.worldTime);
+    }
 
-    updateMovement(deltaTime);
-    updateAnimation(deltaTime);
+    void step(FlyerEnemy& enemy, const EnemyContext& context) {
+        // Vertical velocity is 40 * sin(3t)
+        float age = ageOf(enemy.body, context.worldTime);
+        enemy.body.position.x = driftX(enemy.body, FlyerEnemy::kType, context.worldTime);
+        enemy.body.position.y = enemy.body.origin.y + sineDriftOffset(age, 40.0f, 3.0f);
+    }
 
-    // Deactivate if off screen
-    if (position_.x < -200.0f) {
-        active_ = false;
+    void step(ShooterEnemy& enemy, const EnemyContext& context) {
+        constexpr const EnemyTraits& traits = kEnemyTraits[static_cast<std::size_t>(ShooterEnemy::kType)];
+        float age = ageOf(enemy.body, context.worldTime);
+        enemy.body.position.x = driftX(enemy.body, ShooterEnemy::kType, context.worldTime);
+        // Fire whenever this frame crossed a multiple of the shot interval
+        float previousAge = std::max(0.0f, age - context.deltaTime);
+        if (std::floor(age / traits.shotInterval) > std::floor(previousAge / traits.shotInterval)) {
+            context.shots->push_back(enemy.body.position + sf::Vector2f(-20.0f, 10.0f));
+        }
     }
-}
 
-void Enemy::updateMovement(float deltaTime) {
-    switch (type_) {
-    case EnemyType::Flyer: {
-        sineTimer_ += deltaTime * 3.0f;
-        position_.x -= speed_ * deltaTime;
-        position_.y += std::sin(sineTimer_) * 40.0f * deltaTime;
-        break;
+    void step(ChaserEnemy& enemy, const EnemyContext& context) {
+        float acceleration = 1.0f + std::max(0.0f, 400.0f - std::abs(context.target.x - enemy.body.position.x)) / 400.0f;
+        enemy.body.position.x -= enemy.body.speed * acceleration * context.deltaTime;
     }
-    case EnemyType::Shooter: {
-        shootTimer_ += deltaTime;
-        position_.x -= (speed_ * 0.6f) * deltaTime;
-        if (shootTimer_ >= 2.5f) {
-            wantsToShoot_ = true;
-            shootTimer_ = 0.0f;
+
+    template <typename T>
+    void updateGroup(std::vector<T>& group, const EnemyContext& context) {
+        constexpr bool canSleep = kEnemyTraits[static_cast<std::size_t>(T::kType)].canSleep;
+        const std::size_t frameCount = enemyFrames(T::kType).size();
+        for (auto& enemy : group) {
+            // Gate on where the enemy is now, not where it was last updated
+            if (canSleep && !context.lod->shouldUpdate(driftX(enemy.body, T::kType, context.worldTime))) continue;
+            step(enemy, context);
+            if (frameCount == 0) continue;
+            float age = ageOf(enemy.body, context.worldTime);
+            enemy.body.frame = static_cast<std::uint8_t>(static_cast<std::size_t>(age / kFrameTime) % frameCount);
         }
-        break;
-    }
-    case EnemyType::Chaser: {
-        float acceleration = 1.0f + std::max(0.0f, 400.0f - std::abs(target_.x - position_.x)) / 400.0f;
-        position_.x -= speed_ * acceleration * deltaTime;
-        break;
+        group.erase(std::remove_if(group.begin(), group.end(),
+            [](const T& enemy) { return enemy.body.position.x < kDespawnX; }),
+            group.end());
     }
-    case EnemyType::Walker:
-    default:
-        position_.x -= speed_ * deltaTime;
-        break;
+
+    template <typename T>
+    void appendGroupBounds(const std::vector<T>& group, AabbBatch& batch) {
+        for (const auto& enemy : group) {
+            batch.push(getEnemyBounds(T::kType, enemy.body));
+        }
     }
 
-    sprite_.setPosition(position_);
-    sprite_.setScale(0.7f, 0.7f);
-    sprite_.setOrigin(0.0f, 0.0f);
+    template <typename T>
+    void captureGroup(const std::vector<T>& group, EnemySnapshot* out, std::size_t capacity, std::size_t& count) {
+        for (const auto& enemy : group) {
+            if (count == capacity) return;
+            EnemySnapshot& snapshot = out[count++];
+            snapshot.position = enemy.body.position;
+            snapshot.origin = enemy.body.origin;
+            snapshot.type = T::kType;
+            snapshot.speed = enemy.body.speed;
+            snapshot.spawnTime = enemy.body.spawnTime;
+        }
+    }
 }
 
-void Enemy::updateAnimation(float deltaTime) {
-    if (frames_.empty()) return;
-
-    animTimer_ += deltaTime;
-    if (animTimer_ >= 0.15f) {
-        animTimer_ = 0.0f;
-        currentFrame_ = (currentFrame_ + 1) % frames_.size();
-    }
-    sprite_.setTexture(*frames_[currentFrame_]);
+sf::FloatRect getEnemyBounds(EnemyType type, const EnemyBody& body) {
+    const FrameList& frames = enemyFrames(type);
+    if (frames.empty()) return sf::FloatRect(body.position.x, body.position.y, 0.0f, 0.0f);
+    sf::Vector2f size = sf::Vector2f(frames[body.frame % frames.size()]->getSize()) * kEnemyScale;
+    return sf::FloatRect(body.position.x, body.position.y, size.x, size.y);
 }
 
-void Enemy::render(sf::RenderWindow& window) {
-    if (active_) {
-        window.draw(sprite_);
-    }
+sf::Sprite getEnemySprite(EnemyType type, const EnemyBody& body) {
+    sf::Sprite sprite;
+    const FrameList& frames = enemyFrames(type);
+    if (frames.empty()) return sprite;
+    sprite.setTexture(*frames[body.frame % frames.size()], true);
+    sprite.setScale(kEnemyScale, kEnemyScale);
+    sprite.setPosition(body.position);
+    return sprite;
 }
 
-sf::FloatRect Enemy::getBounds() const {
-    return sprite_.getGlobalBounds();
+void EnemySet::spawn(EnemyType type, const sf::Vector2f& position, float speed, float spawnTime) {
+    EnemySnapshot snapshot;
+    snapshot.position = position;
+    snapshot.origin = position;
+    snapshot.type = type;
+    snapshot.speed = speed;
+    snapshot.spawnTime = spawnTime;
+    add(snapshot);
 }
 
-sf::Vector2f Enemy::getPosition() const {
-    return position_;
+void EnemySet::add(const EnemySnapshot& snapshot) {
+    EnemyBody body;
+    body.position = snapshot.position;
+    body.origin = snapshot.origin;
+    body.speed = snapshot.speed;
+    body.spawnTime = snapshot.spawnTime;
+
+    switch (snapshot.type) {
+    case EnemyType::Flyer:
+        flyers_.push_back(FlyerEnemy{ body });
+        break;
+    case EnemyType::Shooter:
+        shooters_.push_back(ShooterEnemy{ body });
+        break;
+    case EnemyType::Chaser:
+        chasers_.push_back(ChaserEnemy{ body });
+        break;
+    case EnemyType::Walker:
+    default:
+        walkers_.push_back(WalkerEnemy{ body });
+        break;
+    }
 }
 
-bool Enemy::isActive() const {
-    return active_;
+void EnemySet::clear() {
+    walkers_.clear();
+    flyers_.clear();
+    shooters_.clear();
+    chasers_.clear();
 }
 
-void Enemy::setActive(bool active) {
-    active_ = active;
+std::size_t EnemySet::size() const {
+    return walkers_.size() + flyers_.size() + shooters_.size() + chasers_.size();
 }
 
-void Enemy::reset(const sf::Vector2f& position) {
-    position_ = position;
-    active_ = true;
-    sineTimer_ = 0.0f;
-    shootTimer_ = 0.0f;
-    animTimer_ = 0.0f;
-    currentFrame_ = 0;
-    sprite_.setPosition(position_);
+void EnemySet::update(float worldTime, float deltaTime, const sf::Vector2f& target,
+    std::vector<sf::Vector2f>& shots, SimulationLod& lod) {
+    const EnemyContext context{ worldTime, deltaTime, target, &shots, &lod };
+    updateGroup(walkers_, context);
+    updateGroup(flyers_, context);
+    updateGroup(shooters_, context);
+    updateGroup(chasers_, context);
 }
 
-void Enemy::setTargetPosition(const sf::Vector2f& target) {
-    target_ = target;
+template <typename T>
+void EnemySet::renderGroup(const std::vector<T>& group, sf::RenderWindow& window) {
+    const FrameList& frames = enemyFrames(T::kType);
+    if (frames.empty()) return;
+    sprite_.setScale(kEnemyScale, kEnemyScale);
+    for (const auto& enemy : group) {
+        sprite_.setTexture(*frames[enemy.body.frame % frames.size()], true);
+        sprite_.setPosition(enemy.body.position);
+        window.draw(sprite_);
+    }
 }
 
-bool Enemy::wantsToShoot() const {
-    return wantsToShoot_;
+void EnemySet::render(sf::RenderWindow& window) {
+    renderGroup(walkers_, window);
+    renderGroup(flyers_, window);
+    renderGroup(shooters_, window);
+    renderGroup(chasers_, window);
 }
 
-sf::Vector2f Enemy::getShootOrigin() const {
-    return position_ + sf::Vector2f(-20.0f, 10.0f);
+void EnemySet::appendBounds(AabbBatch& batch) const {
+    appendGroupBounds(walkers_, batch);
+    appendGroupBounds(flyers_, batch);
+    appendGroupBounds(shooters_, batch);
+    appendGroupBounds(chasers_, batch);
 }
 
+std::size_t EnemySet::capture(EnemySnapshot* out, std::size_t capacity) const {
+    std::size_t count = 0;
+    captureGroup(walkers_, out, capacity, count);
+    captureGroup(flyers_, out, capacity, count);
+    captureGroup(shooters_, out, capacity, count);
+    captureGroup(chasers_, out, capacity, count);
+    return count;
+}
@@ -1,54 +1,145 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include "Animation.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
+#include "AabbBatch.h"
 #include "ResourceManager.h"
+#include "SimulationLod.h"
+#include "TraitTable.h"
 
-enum class EnemyType {
+enum class EnemyType : std::uint8_t {
     Walker,
     Flyer,
     Shooter,
-    Chaser
+    Chaser,
+    Count
 };
 
-class Enemy {
+constexpr std::size_t kEnemyTypeCount = static_cast<std::size_t>(EnemyType::Count);
+
+struct EnemyTraits {
+    EnemyType type;
+    const char* frames[2];  // animation frames; "enemy" is used if neither is loaded
+    float speedScale;       // fraction of the spawn speed the enemy moves at
+    float shotInterval;     // seconds between shots, 0 if the type does not shoot
+    bool canSleep;          // path is a function of time, so updates may be skipped
+};
+
+inline constexpr std::array<EnemyTraits, kEnemyTypeCount> kEnemyTraits = { {
+    { EnemyType::Walker,  { "spikeMan_walk1", "spikeMan_walk2" },   1.0f, 0.0f, true },
+    { EnemyType::Flyer,   { "flyMan_fly", "flyMan_still_fly" },     1.0f, 0.0f, true },
+    { EnemyType::Shooter, { "wingMan1", "wingMan2" },               0.6f, 2.5f, false },  // fires on its own clock
+    { EnemyType::Chaser,  { "spikeMan_jump", "spikeMan_walk1" },    1.0f, 0.0f, false },  // steers by the player
+} };
+
+static_assert(coversEveryValue(kEnemyTraits), "kEnemyTraits must have one entry per EnemyType, in enum order");
+
+constexpr const EnemyTraits& enemyTraits(EnemyType type) {
+    return kEnemyTraits[static_cast<std::size_t>(type)];
+}
+
+struct EnemySnapshot {
+    sf::Vector2f position;
+    sf::Vector2f origin;
+    EnemyType type = EnemyType::Walker;
+    float speed = 0.0f;
+    float spawnTime = 0.0f;
+};
+
+// Fields every enemy has. Walkers, flyers and shooters follow closed-form
+// paths from origin and spawnTime; position caches where update() last put
+// them. Chasers react to the player, so their position is integrated.
+struct EnemyBody {
+    sf::Vector2f position;
+    sf::Vector2f origin;
+    float speed = 0.0f;
+    float spawnTime = 0.0f;
+    std::uint8_t frame = 0;
+};
+
+// One struct per type so each array gets its own movement kernel
+struct WalkerEnemy {
+    static constexpr EnemyType kType = EnemyType::Walker;
+    EnemyBody body;
+};
+
+struct FlyerEnemy {
+    static constexpr EnemyType kType = EnemyType::Flyer;
+    EnemyBody body;
+};
+
+struct ShooterEnemy {
+    static constexpr EnemyType kType = EnemyType::Shooter;
+    EnemyBody body;
+};
+
+struct ChaserEnemy {
+    static constexpr EnemyType kType = EnemyType::Chaser;
+    EnemyBody body;
+};
+
+sf::FloatRect getEnemyBounds(EnemyType type, const EnemyBody& body);
+// The sprite the enemy is drawn with, for pixel-exact hits
+sf::Sprite getEnemySprite(EnemyType type, const EnemyBody& body);
+
+// All live enemies, kept in one homogeneous array per type. Each array is
+// updated by a kernel specialised for its type, so there is no per-enemy
+// switch and no enemy carries fields another type needs.
+class EnemySet {
 public:
-    Enemy(const sf::Vector2f& position, EnemyType type = EnemyType::Walker, float speed = 150.0f);
+    void spawn(EnemyType type, const sf::Vector2f& position, float speed, float spawnTime);
+    void add(const EnemySnapshot& snapshot);
+    void clear();
+    std::size_t size() const;
 
-    void update(float deltaTime);
+    // Shooters that fire this frame append their muzzle position to shots.
+    // Enemies that leave the world on the left are removed. Types that can
+    // sleep are only updated when lod says so.
+    void update(float worldTime, float deltaTime, const sf::Vector2f& target,
+        std::vector<sf::Vector2f>& shots, SimulationLod& lod);
     void render(sf::RenderWindow& window);
-    void setTargetPosition(const sf::Vector2f& target);
-    bool wantsToShoot() const;
-    sf::Vector2f getShootOrigin() const;
 
-    sf::FloatRect getBounds() const;
-    sf::Vector2f getPosition() const;
-    EnemyType getType() const { return type_; }
+    // Writes up to capacity snapshots and returns how many were written
+    std::size_t capture(EnemySnapshot* out, std::size_t capacity) const;
 
-    bool isActive() const;
-    void setActive(bool active);
+    // Appends every enemy's bounds to batch, one entry per removeIf() slot
+    void appendBounds(AabbBatch& batch) const;
 
-    void reset(const sf::Vector2f& position);
+    // fn(const EnemyBody&, EnemyType, std::size_t slot) returns true to remove the enemy.
+    // slot is the enemy's entry in the last appendBounds(); removals made
+    // during the walk do not disturb the slots of enemies not yet visited.
+    template <typename Fn>
+    void removeIf(Fn fn) {
+        std::size_t slot = 0;
+        removeIfIn(walkers_, slot, fn);
+        removeIfIn(flyers_, slot, fn);
+        removeIfIn(shooters_, slot, fn);
+        removeIfIn(chasers_, slot, fn);
+    }
 
 private:
-    void loadAnimation();
-    void updateAnimation(float deltaTime);
-    void updateMovement(float deltaTime);
+    // Walks back to front, so a swap-remove only moves an enemy already visited
+    template <typename T, typename Fn>
+    static void removeIfIn(std::vector<T>& group, std::size_t& slot, Fn& fn) {
+        const std::size_t count = group.size();
+        for (std::size_t i = count; i-- > 0;) {
+            if (fn(group[i].body, T::kType, slot + i)) {
+                group[i] = group.back();
+                group.pop_back();
+            }
+        }
+        slot += count;
+    }
 
+    template <typename T>
+    void renderGroup(const std::vector<T>& group, sf::RenderWindow& window);
+
+    std::vector<WalkerEnemy> walkers_;
+    std::vector<FlyerEnemy> flyers_;
+    std::vector<ShooterEnemy> shooters_;
+    std::vector<ChaserEnemy> chasers_;
     sf::Sprite sprite_;
-    sf::Vector2f position_;
-    sf::Vector2f target_;
-    float speed_;
-    bool active_;
-    bool facingRight_;
-    EnemyType type_;
-    float sineTimer_;
-    float shootTimer_;
-    bool wantsToShoot_;
-
-    Animation walkAnim_;
-    std::vector<sf::Texture*> frames_;
-    float animTimer_;
-    std::size_t currentFrame_;
-};
\ No newline at end of file
+};
@@ -0,0 +1,146 @@
+#include "EntityRegistry.h"
+#include <algorithm>
+#include <string>
+
+std::size_t EntityRegistry::create(Behavior behavior, const sf::Vector2f& position) {
+    transforms_.push_back(Transform{ position });
+    velocities_.emplace_back();
+    bounds_.emplace_back();
+    sprites_.emplace_back();
+    lifetimes_.emplace_back();
+    behaviors_.push_back(behavior);
+    masks_.push_back(0);
+    return behaviors_.size() - 1;
+}
+
+void EntityRegistry::setVelocity(std::size_t index, const sf::Vector2f& velocity) {
+    velocities_[index].value = velocity;
+    masks_[index] |= HasVelocity;
+}
+
+void EntityRegistry::setAabb(std::size_t index, const sf::Vector2f& offset, const sf::Vector2f& size) {
+    bounds_[index] = Aabb{ offset, size };
+    masks_[index] |= HasAabb;
+}
+
+void EntityRegistry::setSprite(std::size_t index, const SpriteRef& sprite) {
+    sprites_[index] = sprite;
+    masks_[index] |= HasSprite;
+}
+
+void EntityRegistry::setLifetime(std::size_t index, float seconds, float fade) {
+    lifetimes_[index] = Lifetime{ seconds, fade };
+    masks_[index] |= HasLifetime;
+}
+
+void EntityRegistry::destroyAll(Behavior behavior) {
+    for (std::size_t i = 0; i < behaviors_.size(); ++i) {
+        if (behaviors_[i] == behavior) {
+            masks_[i] |= Destroyed;
+        }
+    }
+}
+
+void EntityRegistry::compact() {
+    std::size_t i = 0;
+    while (i < behaviors_.size()) {
+        if (isAlive(i)) {
+            ++i;
+            continue;
+        }
+        const std::size_t last = behaviors_.size() - 1;
+        transforms_[i] = transforms_[last];
+        velocities_[i] = velocities_[last];
+        bounds_[i] = bounds_[last];
+        sprites_[i] = sprites_[last];
+        lifetimes_[i] = lifetimes_[last];
+        behaviors_[i] = behaviors_[last];
+        masks_[i] = masks_[last];
+        transforms_.pop_back();
+        velocities_.pop_back();
+        bounds_.pop_back();
+        sprites_.pop_back();
+        lifetimes_.pop_back();
+        behaviors_.pop_back();
+        masks_.pop_back();
+    }
+}
+
+void EntityRegistry::clear() {
+    transforms_.clear();
+    velocities_.clear();
+    bounds_.clear();
+    sprites_.clear();
+    lifetimes_.clear();
+    behaviors_.clear();
+    masks_.clear();
+}
+
+sf::FloatRect EntityRegistry::getBounds(std::size_t index) const {
+    if (!(masks_[index] & HasAabb)) return sf::FloatRect();
+    const Aabb& box = bounds_[index];
+    const sf::Vector2f& position = transforms_[index].position;
+    return sf::FloatRect(position.x + box.offset.x, position.y + box.offset.y, box.size.x, box.size.y);
+}
+
+void EntityRegistry::integrate(float deltaTime) {
+    for (std::size_t i = 0; i < transforms_.size(); ++i) {
+        if (masks_[i] & HasVelocity) {
+            transforms_[i].position += velocities_[i].value * deltaTime;
+        }
+    }
+}
+
+void EntityRegistry::age(float deltaTime) {
+    for (std::size_t i = 0; i < lifetimes_.size(); ++i) {
+        if (!(masks_[i] & HasLifetime)) continue;
+        lifetimes_[i].remaining -= deltaTime;
+        if (lifetimes_[i].remaining <= 0.0f) {
+            masks_[i] |= Destroyed;
+        }
+    }
+}
+
+void EntityRegistry::render(sf::RenderWindow& window, RenderLayer layer, const sf::Font* font) {
+    for (std::size_t i = 0; i < sprites_.size(); ++i) {
+        const std::uint8_t mask = masks_[i];
+        if (!(mask & HasSprite) || (mask & Destroyed)) continue;
+        const SpriteRef& ref = sprites_[i];
+        if (ref.layer != layer) continue;
+
+        sf::Color color = ref.color;
+        if ((mask & HasLifetime) && lifetimes_[i].fade > 0.0f) {
+            float alpha = std::clamp(lifetimes_[i].remaining / lifetimes_[i].fade, 0.0f, 1.0f);
+            color.a = static_cast<sf::Uint8>(alpha * color.a);
+        }
+
+        switch (ref.kind) {
+        case DrawKind::Sprite:
+            if (!ref.texture) break;
+            sprite_.setTexture(*ref.texture, true);
+            sprite_.setScale(ref.scale, ref.scale);
+            sprite_.setColor(color);
+            sprite_.setPosition(transforms_[i].position);
+            window.draw(sprite_);
+            break;
+        case DrawKind::Circle:
+            circle_.setRadius(ref.scale);
+            circle_.setOrigin(ref.scale, ref.scale);
+            circle_.setFillColor(color);
+            circle_.setPosition(transforms_[i].position);
+            window.draw(circle_);
+            break;
+        case DrawKind::Label:
+            if (!font) break;
+            text_.setFont(*font);
+            text_.setCharacterSize(24);
+            text_.setFillColor(color);
+            text_.setOutlineColor(sf::Color(0, 0, 0, color.a));
+            text_.setOutlineThickness(2.0f);
+            text_.setString("+" + std::to_string(ref.label));
+            text_.setPosition(transforms_[i].position);
+            window.draw(text_);
+            break;
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class Behavior : std::uint8_t {
+    None,
+    Projectile,
+    ScorePopup,
+    Cloud
+};
+
+enum class RenderLayer : std::uint8_t {
+    Sky,
+    World,
+    Overlay
+};
+
+enum class DrawKind : std::uint8_t {
+    Sprite,
+    Circle,
+    Label
+};
+
+struct Transform {
+    sf::Vector2f position;
+};
+
+struct Velocity {
+    sf::Vector2f value;
+};
+
+// Collision box relative to the transform
+struct Aabb {
+    sf::Vector2f offset;
+    sf::Vector2f size;
+};
+
+struct SpriteRef {
+    DrawKind kind = DrawKind::Sprite;
+    RenderLayer layer = RenderLayer::World;
+    const sf::Texture* texture = nullptr;  // Sprite
+    float scale = 1.0f;                     // Sprite scale, Circle radius
+    sf::Color color = sf::Color::White;
+    int label = 0;                          // Label shows "+label"
+};
+
+struct Lifetime {
+    float remaining = 0.0f;
+    float fade = 0.0f;  // alpha ramps down over the last `fade` seconds
+};
+
+// Free-moving entities that are not tied to a world chunk. Every entity has
+// a slot in each dense component array and a mask saying which components it
+// uses; systems walk the arrays front to back. destroy() only marks an
+// entity, and compact() swap-removes the marked ones, so indices are stable
+// between compactions only.
+class EntityRegistry {
+public:
+    enum ComponentMask : std::uint8_t {
+        HasVelocity = 1 << 0,
+        HasAabb     = 1 << 1,
+        HasSprite   = 1 << 2,
+        HasLifetime = 1 << 3,
+        Destroyed   = 1 << 7
+    };
+
+    std::size_t create(Behavior behavior, const sf::Vector2f& position);
+    void setVelocity(std::size_t index, const sf::Vector2f& velocity);
+    void setAabb(std::size_t index, const sf::Vector2f& offset, const sf::Vector2f& size);
+    void setSprite(std::size_t index, const SpriteRef& sprite);
+    void setLifetime(std::size_t index, float seconds, float fade);
+
+    void destroy(std::size_t index) { masks_[index] |= Destroyed; }
+    void destroyAll(Behavior behavior);
+    void compact();
+    void clear();
+
+    std::size_t size() const { return behaviors_.size(); }
+    bool isAlive(std::size_t index) const { return (masks_[index] & Destroyed) == 0; }
+    bool is(std::size_t index, Behavior behavior) const { return behaviors_[index] == behavior && isAlive(index); }
+    sf::Vector2f getPosition(std::size_t index) const { return transforms_[index].position; }
+    void setPosition(std::size_t index, const sf::Vector2f& position) { transforms_[index].position = position; }
+    sf::Vector2f getVelocity(std::size_t index) const { return velocities_[index].value; }
+    sf::FloatRect getBounds(std::size_t index) const;
+
+    // Systems
+    void integrate(float deltaTime);
+    void age(float deltaTime);
+    void render(sf::RenderWindow& window, RenderLayer layer, const sf::Font* font);
+
+private:
+    std::vector<Transform> transforms_;
+    std::vector<Velocity> velocities_;
+    std::vector<Aabb> bounds_;
+    std::vector<SpriteRef> sprites_;
+    std::vector<Lifetime> lifetimes_;
+    std::vector<Behavior> behaviors_;
+    std::vector<std::uint8_t> masks_;
+
+    // Reused drawables so rendering does not build SFML objects per entity
+    sf::Sprite sprite_;
+    sf::CircleShape circle_;
+    sf::Text text_;
+};
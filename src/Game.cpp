@@ -1,5 +1,6 @@
 #include "Game.h"
 #include "MenuState.h"
+#include "SoundMixer.h"
 #include <iostream>
 
 Game::Game()
@@ -60,6 +61,7 @@ void Game::handleEvents() {
 }
 
 void Game::update(float deltaTime) {
+    SoundMixer::getInstance().beginFrame();
     if (!states_.empty()) {
         states_.top()->update(deltaTime);
     }
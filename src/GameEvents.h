@@ -0,0 +1,104 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Collectible.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+enum class GameEventType : std::uint8_t {
+    Collected,       // a scoring pickup
+    PowerUpStarted,  // a power-up pickup
+    EnemyKilled,
+    Penalized        // touched something that costs points
+};
+
+enum class DamageSource : std::uint8_t {
+    Ceiling,
+    Enemy,
+    Projectile,
+    Cactus,
+    Count
+};
+
+constexpr std::size_t kDamageSourceCount = static_cast<std::size_t>(DamageSource::Count);
+
+// Something that happened to the player this tick. Only the fields of the
+// event's type are meaningful.
+struct GameEvent {
+    GameEventType type = GameEventType::Collected;
+    CollectibleType item = CollectibleType::Coin;  // Collected, PowerUpStarted
+    bool shielded = false;                         // EnemyKilled: the shield took the hit
+    int amount = 0;                                // Penalized: points lost
+    sf::Vector2f position;
+
+    static GameEvent collected(CollectibleType item, const sf::Vector2f& position) {
+        GameEvent event;
+        event.type = GameEventType::Collected;
+        event.item = item;
+        event.position = position;
+        return event;
+    }
+
+    static GameEvent powerUpStarted(CollectibleType item, const sf::Vector2f& position) {
+        GameEvent event = collected(item, position);
+        event.type = GameEventType::PowerUpStarted;
+        return event;
+    }
+
+    static GameEvent enemyKilled(const sf::Vector2f& position, bool shielded) {
+        GameEvent event;
+        event.type = GameEventType::EnemyKilled;
+        event.shielded = shielded;
+        event.position = position;
+        return event;
+    }
+
+    static GameEvent penalized(int amount) {
+        GameEvent event;
+        event.type = GameEventType::Penalized;
+        event.amount = amount;
+        return event;
+    }
+};
+
+// Gameplay events of one tick, in the order they happened, plus the hits
+// taken per damage source. Collision code appends to it and the consumers
+// read the whole batch once at the end of the tick. Storage is fixed, so a
+// tick never allocates.
+class GameEventQueue {
+public:
+    static constexpr std::size_t kCapacity = 64;
+
+    // Pickups, kills and penalties; one tick produces far fewer than
+    // kCapacity, and any beyond it are dropped
+    void push(const GameEvent& event) {
+        if (count_ < kCapacity) {
+            events_[count_++] = event;
+        }
+    }
+
+    // Hits are counted rather than queued, so a full queue never loses one
+    void addDamage(DamageSource source) {
+        std::uint16_t& hits = damage_[static_cast<std::size_t>(source)];
+        if (hits < std::numeric_limits<std::uint16_t>::max()) ++hits;
+    }
+
+    void clear() {
+        count_ = 0;
+        damage_.fill(0);
+    }
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    std::uint16_t damageFrom(DamageSource source) const { return damage_[static_cast<std::size_t>(source)]; }
+
+    const GameEvent* begin() const { return events_.data(); }
+    const GameEvent* end() const { return events_.data() + count_; }
+
+private:
+    std::array<GameEvent, kCapacity> events_{};
+    std::size_t count_ = 0;
+    std::array<std::uint16_t, kDamageSourceCount> damage_{};
+};
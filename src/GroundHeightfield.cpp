@@ -0,0 +1,82 @@
+#include "GroundHeightfield.h"
+#include "Platform.h"
+#include "ResourceManager.h"
+#include <algorithm>
+
+namespace {
+    // Index of the first run that ends after x
+    std::size_t firstRunEndingAfter(const std::vector<GroundRun>& runs, float x) {
+        auto it = std::upper_bound(runs.begin(), runs.end(), x,
+            [](float value, const GroundRun& run) { return value < run.endX; });
+        return static_cast<std::size_t>(it - runs.begin());
+    }
+
+    // Shared strip, built on first use once textures are loaded. The ground
+    // has its own texture, loaded repeated, so platforms are unaffected.
+    sf::RectangleShape& groundStrip() {
+        static sf::RectangleShape strip = [] {
+            sf::RectangleShape shape;
+            auto& rm = ResourceManager::getInstance();
+            const PlatformTraits& traits = platformTraits(PlatformType::Normal);
+            if (rm.hasTexture("ground")) {
+                shape.setTexture(&rm.getTexture("ground"));
+            }
+            else {
+                shape.setFillColor(sf::Color(traits.color[0], traits.color[1], traits.color[2]));
+                shape.setOutlineColor(sf::Color(34, 139, 34));
+                shape.setOutlineThickness(2.0f);
+            }
+            return shape;
+        }();
+        return strip;
+    }
+}
+
+void GroundHeightfield::append(float startX, float endX, float top) {
+    if (endX <= startX) return;
+    if (!runs_.empty()) {
+        GroundRun& last = runs_.back();
+        if (last.endX == startX && last.top == top) {
+            last.endX = endX;
+            return;
+        }
+    }
+    runs_.push_back(GroundRun{ startX, endX, top });
+}
+
+float GroundHeightfield::topAt(float x) const {
+    std::size_t i = firstRunEndingAfter(runs_, x);
+    if (i < runs_.size() && runs_[i].startX <= x) {
+        return runs_[i].top;
+    }
+    return kNoGround;
+}
+
+float GroundHeightfield::topUnder(float left, float right) const {
+    float top = kNoGround;
+    for (std::size_t i = firstRunEndingAfter(runs_, left); i < runs_.size() && runs_[i].startX < right; ++i) {
+        top = std::min(top, runs_[i].top);
+    }
+    return top;
+}
+
+void GroundHeightfield::render(sf::RenderWindow& window, float left, float right) const {
+    sf::RectangleShape& strip = groundStrip();
+    const float textureHeight = strip.getTexture() ? static_cast<float>(strip.getTexture()->getSize().y) : 0.0f;
+    const float texelsPerPixel = textureHeight / kDepth;
+    for (std::size_t i = firstRunEndingAfter(runs_, left); i < runs_.size() && runs_[i].startX < right; ++i) {
+        // Clip to the visible span so the strip stays small however long the run is
+        const GroundRun& run = runs_[i];
+        float startX = std::max(run.startX, left);
+        float endX = std::min(run.endX, right);
+        strip.setPosition(startX, run.top);
+        strip.setSize(sf::Vector2f(endX - startX, kDepth));
+        if (texelsPerPixel > 0.0f) {
+            // One tile fills the full depth and repeats along x only. Texture
+            // coordinates follow world x so tiles do not slide as the span is clipped.
+            strip.setTextureRect(sf::IntRect(static_cast<int>(startX * texelsPerPixel), 0,
+                static_cast<int>((endX - startX) * texelsPerPixel), static_cast<int>(textureHeight)));
+        }
+        window.draw(strip);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// One solid stretch of ground; everything between runs is a gap
+struct GroundRun {
+    float startX = 0.0f;
+    float endX = 0.0f;
+    float top = 0.0f;
+};
+
+// Ground as a run-length heightfield: runs sorted by x, with touching runs
+// of the same height merged into one. Lookups are a binary search over the
+// runs, and each run renders as a single strip of repeated texture.
+class GroundHeightfield {
+public:
+    static constexpr float kNoGround = std::numeric_limits<float>::infinity();
+    static constexpr float kDepth = 140.0f;  // drawn thickness below the top
+
+    // Runs must be appended left to right
+    void append(float startX, float endX, float top);
+    void clear() { runs_.clear(); }
+
+    // Top of the ground at x, or kNoGround over a gap
+    float topAt(float x) const;
+    // Highest top (smallest y) of any run overlapping [left, right), or kNoGround
+    float topUnder(float left, float right) const;
+
+    const std::vector<GroundRun>& getRuns() const { return runs_; }
+
+    // Draws the runs that overlap [left, right)
+    void render(sf::RenderWindow& window, float left, float right) const;
+
+private:
+    std::vector<GroundRun> runs_;
+};
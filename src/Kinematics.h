@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cmath>
+
+// Closed-form motion shared by platforms, enemies and collectibles. Each
+// function takes the time an object has existed (or a distance derived from
+// it) and returns its offset from where it spawned, so a position can be
+// evaluated for any moment without replaying the frames in between.
+
+constexpr float kKinematicsPi = 3.14159265f;
+constexpr float kKinematicsTwoPi = 6.28318531f;
+
+// Offset of an object that moves back and forth between -range and +range,
+// starting at 0 heading forward, after covering `travelled` distance.
+inline float pingPongOffset(float travelled, float range) {
+    if (range <= 0.0f) return 0.0f;
+    float p = std::fmod(travelled, 4.0f * range);
+    if (p < range) return p;
+    if (p < 3.0f * range) return 2.0f * range - p;
+    return p - 4.0f * range;
+}
+
+// Offset after `age` seconds of an object whose velocity is
+// rate * sin(frequency * t), i.e. the integral of that velocity from 0.
+inline float sineDriftOffset(float age, float rate, float frequency) {
+    return rate / frequency * (1.0f - std::cos(frequency * age));
+}
+
+// Wraps an angle in radians into [-pi, pi)
+inline float wrapAngle(float angle) {
+    return angle - kKinematicsTwoPi * std::floor((angle + kKinematicsPi) / kKinematicsTwoPi);
+}
@@ -1,32 +1,21 @@
 #include "Platform.h"
 #include "Player.h"
-
-namespace {
-    sf::Color getPlatformColor(PlatformType type) {
-        switch (type) {
-        case PlatformType::MovingHorizontal: return sf::Color(173, 216, 230); // light blue
-        case PlatformType::MovingVertical:   return sf::Color(255, 182, 193); // pink
-        case PlatformType::Breaking:         return sf::Color(255, 160, 122); // salmon
-        case PlatformType::Bouncy:           return sf::Color(255, 255, 102); // yellow
-        case PlatformType::Ice:              return sf::Color(200, 255, 255);
-        default:                             return sf::Color(144, 238, 144);
-        }
-    }
-}
+#include "Kinematics.h"
+#include <algorithm>
 
 Platform::Platform(const sf::Vector2f& position,
     const sf::Vector2f& size,
     PlatformType type,
     float movementRange,
-    float movementSpeed)
+    float movementSpeed,
+    float phase)
     : position_(position)
     , size_(size)
     , type_(type)
     , originPosition_(position)
     , movementRange_(movementRange)
     , movementSpeed_(movementSpeed)
-    , movementTimer_(0.0f)
-    , movingForward_(true)
+    , phase_(phase)
     , breaking_(false)
     , breakTimer_(0.0f)
     , active_(true) {
@@ -36,14 +25,9 @@ Platform::Platform(const sf::Vector2f& position,
     shape_.setPosition(position_);
     shape_.setSize(size_);
 
-    const std::string textureName =
-        type == PlatformType::Ice ? "platform_snow" :
-        type == PlatformType::Bouncy ? "platform_cake" :
-        type == PlatformType::MovingHorizontal || type == PlatformType::MovingVertical ? "platform_sand" :
-        "platform";
-
-    if (rm.hasTexture(textureName)) {
-        shape_.setTexture(&rm.getTexture(textureName));
+    const PlatformTraits& traits = platformTraits(type);
+    if (rm.hasTexture(traits.textureName)) {
+        shape_.setTexture(&rm.getTexture(traits.textureName));
         shape_.setTextureRect(sf::IntRect(0, 0, static_cast<int>(size_.x), static_cast<int>(size_.y)));
     }
     else if (rm.hasTexture("platform")) {
@@ -51,35 +35,57 @@ Platform::Platform(const sf::Vector2f& position,
         shape_.setTextureRect(sf::IntRect(0, 0, static_cast<int>(size_.x), static_cast<int>(size_.y)));
     }
     else {
-        shape_.setFillColor(getPlatformColor(type));
+        shape_.setFillColor(sf::Color(traits.color[0], traits.color[1], traits.color[2]));
         shape_.setOutlineColor(sf::Color(34, 139, 34));
         shape_.setOutlineThickness(2.0f);
     }
 }
 
-void Platform::update(float deltaTime) {
-    if (!active_) return;
-    updateMovement(deltaTime);
-    updateBreaking(deltaTime);
+Platform::Platform(const PlatformSnapshot& snapshot)
+    : Platform(snapshot.originPosition, snapshot.size, snapshot.type, snapshot.movementRange, snapshot.movementSpeed, snapshot.phase) {
+    position_ = snapshot.position;
+    breaking_ = snapshot.breaking;
+    breakTimer_ = snapshot.breakTimer;
+    active_ = snapshot.active;
+    shape_.setPosition(position_);
+    if (breaking_) {
+        updateBreaking(0.0f);
+    }
 }
 
-void Platform::updateMovement(float deltaTime) {
-    if (type_ == PlatformType::MovingHorizontal) {
-        float displacement = movementSpeed_ * deltaTime * (movingForward_ ? 1.0f : -1.0f);
-        position_.x += displacement;
-        if (std::abs(position_.x - originPosition_.x) >= movementRange_) {
-            movingForward_ = !movingForward_;
-        }
-        shape_.setPosition(position_);
-    }
-    else if (type_ == PlatformType::MovingVertical) {
-        float displacement = movementSpeed_ * deltaTime * (movingForward_ ? 1.0f : -1.0f);
-        position_.y += displacement;
-        if (std::abs(position_.y - originPosition_.y) >= movementRange_) {
-            movingForward_ = !movingForward_;
-        }
+PlatformSnapshot Platform::getSnapshot() const {
+    PlatformSnapshot snapshot;
+    snapshot.position = position_;
+    snapshot.size = size_;
+    snapshot.originPosition = originPosition_;
+    snapshot.type = type_;
+    snapshot.movementRange = movementRange_;
+    snapshot.movementSpeed = movementSpeed_;
+    snapshot.phase = phase_;
+    snapshot.breakTimer = breakTimer_;
+    snapshot.breaking = breaking_;
+    snapshot.active = active_;
+    return snapshot;
+}
+
+void Platform::update(float worldTime, float deltaTime) {
+    if (!active_) return;
+    if (platformTraits(type_).motion != PlatformMotion::None) {
+        position_ = positionAt(worldTime);
         shape_.setPosition(position_);
     }
+    updateBreaking(deltaTime);
+}
+
+sf::Vector2f Platform::positionAt(float worldTime) const {
+    const PlatformMotion motion = platformTraits(type_).motion;
+    if (motion == PlatformMotion::None) return originPosition_;
+
+    float travelled = phase_ + movementSpeed_ * std::max(0.0f, worldTime);
+    float offset = pingPongOffset(travelled, movementRange_);
+    return motion == PlatformMotion::Horizontal
+        ? sf::Vector2f(originPosition_.x + offset, originPosition_.y)
+        : sf::Vector2f(originPosition_.x, originPosition_.y + offset);
 }
 
 void Platform::startBreaking() {
@@ -121,17 +127,18 @@ sf::Vector2f Platform::getPosition() const {
 }
 
 void Platform::applyTypeEffect(Player& player) {
-    switch (type_) {
-    case PlatformType::Bouncy:
-        player.bounce(-900.0f);
+    const PlatformTraits& traits = platformTraits(type_);
+    switch (traits.effect) {
+    case PlatformEffect::Bounce:
+        player.bounce(traits.strength);
         break;
-    case PlatformType::Ice:
-        player.setIceTime(0.8f);
+    case PlatformEffect::Ice:
+        player.setIceTime(traits.strength);
         break;
-    case PlatformType::Breaking:
+    case PlatformEffect::Break:
         startBreaking();
         break;
-    default:
+    case PlatformEffect::None:
         break;
     }
 }
\ No newline at end of file
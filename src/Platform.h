@@ -2,17 +2,73 @@
 
 #include <SFML/Graphics.hpp>
 #include "ResourceManager.h"
+#include "TraitTable.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 class Player;
 
-enum class PlatformType {
+enum class PlatformType : std::uint8_t {
     Normal,
     MovingHorizontal,
     MovingVertical,
     Breaking,
     Bouncy,
-    Ice
+    Ice,
+    Count
+};
+
+enum class PlatformMotion : std::uint8_t {
+    None,
+    Horizontal,
+    Vertical
+};
+
+// What landing on the platform does to the player
+enum class PlatformEffect : std::uint8_t {
+    None,
+    Break,
+    Bounce,  // strength is the launch velocity
+    Ice      // strength is seconds of reduced traction
+};
+
+struct PlatformTraits {
+    PlatformType type;
+    const char* textureName;
+    std::uint8_t color[3];  // fill colour when no texture is loaded
+    PlatformMotion motion;
+    PlatformEffect effect;
+    float strength;
+};
+
+inline constexpr std::array<PlatformTraits, static_cast<std::size_t>(PlatformType::Count)> kPlatformTraits = { {
+    { PlatformType::Normal,           "platform",      { 144, 238, 144 }, PlatformMotion::None,       PlatformEffect::None,      0.0f },
+    { PlatformType::MovingHorizontal, "platform_sand", { 173, 216, 230 }, PlatformMotion::Horizontal, PlatformEffect::None,      0.0f },  // light blue
+    { PlatformType::MovingVertical,   "platform_sand", { 255, 182, 193 }, PlatformMotion::Vertical,   PlatformEffect::None,      0.0f },  // pink
+    { PlatformType::Breaking,         "platform",      { 255, 160, 122 }, PlatformMotion::None,       PlatformEffect::Break,     0.0f },  // salmon
+    { PlatformType::Bouncy,           "platform_cake", { 255, 255, 102 }, PlatformMotion::None,       PlatformEffect::Bounce, -900.0f },  // yellow
+    { PlatformType::Ice,              "platform_snow", { 200, 255, 255 }, PlatformMotion::None,       PlatformEffect::Ice,       0.8f },
+} };
+
+static_assert(coversEveryValue(kPlatformTraits), "kPlatformTraits must have one entry per PlatformType, in enum order");
+
+constexpr const PlatformTraits& platformTraits(PlatformType type) {
+    return kPlatformTraits[static_cast<std::size_t>(type)];
+}
+
+struct PlatformSnapshot {
+    sf::Vector2f position;
+    sf::Vector2f size;
+    sf::Vector2f originPosition;
+    PlatformType type = PlatformType::Normal;
+    float movementRange = 0.0f;
+    float movementSpeed = 0.0f;
+    float phase = 0.0f;
+    float breakTimer = 0.0f;
+    bool breaking = false;
+    bool active = true;
 };
 
 class Platform {
@@ -21,9 +77,14 @@ public:
         const sf::Vector2f& size,
         PlatformType type = PlatformType::Normal,
         float movementRange = 0.0f,
-        float movementSpeed = 0.0f);
+        float movementSpeed = 0.0f,
+        float phase = 0.0f);
+    explicit Platform(const PlatformSnapshot& snapshot);
 
-    void update(float deltaTime);
+    // Moves the platform to where it is at worldTime and advances breaking
+    void update(float worldTime, float deltaTime);
+    // Where the platform's motion puts it at worldTime; needs no update() calls
+    sf::Vector2f positionAt(float worldTime) const;
     void render(sf::RenderWindow& window);
     void startBreaking();
     bool isBroken() const;
@@ -35,9 +96,9 @@ public:
     void applyTypeEffect(Player& player);
     bool isActive() const { return active_; }
     void deactivate() { active_ = false; }
+    PlatformSnapshot getSnapshot() const;
 
 private:
-    void updateMovement(float deltaTime);
     void updateBreaking(float deltaTime);
 
     sf::RectangleShape shape_;
@@ -47,8 +108,7 @@ private:
     sf::Vector2f originPosition_;
     float movementRange_;
     float movementSpeed_;
-    float movementTimer_;
-    bool movingForward_;
+    float phase_;  // distance travelled at world time 0
 
     bool breaking_;
     float breakTimer_;
@@ -1,4 +1,5 @@
 #include "Player.h"
+#include "SoundMixer.h"
 #include <SFML/Window/Keyboard.hpp>
 #include <algorithm>
 #include <iostream>
@@ -12,8 +13,7 @@ Player::Player()
     , smallJumpStrength_(-450.0f) // normal single jump
     , runSpeed_(150.0f)           // adjusted speed
     , speedBoostMultiplier_(1.0f)
-    , speedBoostTimer_(0.0f)
-    , iceTimer_(0.0f)
+    , clock_(0.0f)
     , slideDuration_(0.5f)
     , slideTimer_(0.0f)
     , grounded_(false)
@@ -38,20 +38,6 @@ Player::Player()
     }
     sprite_.setPosition(position_);
     sprite_.setScale(0.4f, 0.4f);
-
-    // Setup sounds
-    if (rm.hasSoundBuffer("jump")) {
-        jumpSound_.setBuffer(rm.getSoundBuffer("jump"));
-        jumpSound_.setVolume(50.0f);
-    }
-    if (rm.hasSoundBuffer("slide")) {
-        slideSound_.setBuffer(rm.getSoundBuffer("slide"));
-        slideSound_.setVolume(40.0f);
-    }
-    if (rm.hasSoundBuffer("death")) {
-        deathSound_.setBuffer(rm.getSoundBuffer("death"));
-        deathSound_.setVolume(60.0f);
-    }
 }
 
 void Player::loadAnimations() {
@@ -116,16 +102,13 @@ void Player::update(float deltaTime) {
         return;
     }
 
-    // Update temporary effects
-    if (speedBoostTimer_ > 0.0f) {
-        speedBoostTimer_ -= deltaTime;
-        if (speedBoostTimer_ <= 0.0f) {
+    // Expire temporary effects
+    clock_ += deltaTime;
+    timers_.advance(clock_, [&](std::size_t id) {
+        if (static_cast<Timer>(id) == Timer::SpeedBoost) {
             speedBoostMultiplier_ = 1.0f;
         }
-    }
-    if (iceTimer_ > 0.0f) {
-        iceTimer_ = std::max(0.0f, iceTimer_ - deltaTime);
-    }
+    });
 
     // Check keyboard state directly for continuous input (jump)
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space) ||
@@ -314,7 +297,7 @@ void Player::jump() {
     grounded_ = false;
     state_ = PlayerState::Jumping;
     jumpAnim_.reset();
-    jumpSound_.play();
+    SoundMixer::getInstance().play("jump", SoundCategory::Player, 1, 50.0f);
 }
 
 void Player::slide() {
@@ -323,7 +306,7 @@ void Player::slide() {
         slideTimer_ = slideDuration_;
         state_ = PlayerState::Sliding;
         slideAnim_.reset();
-        slideSound_.play();
+        SoundMixer::getInstance().play("slide", SoundCategory::Player, 1, 40.0f);
     }
 }
 
@@ -332,7 +315,7 @@ void Player::die() {
         state_ = PlayerState::Dead;
         velocity_ = sf::Vector2f(0.0f, -200.0f);
         deathAnim_.reset();
-        deathSound_.play();
+        SoundMixer::getInstance().play("death", SoundCategory::Player, 3, 60.0f);
     }
 }
 
@@ -396,17 +379,17 @@ void Player::setRunSpeed(float speed) {
 }
 
 float Player::getRunSpeed() const {
-    float iceBonus = iceTimer_ > 0.0f ? 0.4f : 1.0f;
+    float iceBonus = timers_.isActive(timerId(Timer::Ice)) ? 0.4f : 1.0f;
     return runSpeed_ * speedBoostMultiplier_ * iceBonus;
 }
 
 void Player::applySpeedBoost(float multiplier, float duration) {
     speedBoostMultiplier_ = multiplier;
-    speedBoostTimer_ = duration;
+    timers_.start(timerId(Timer::SpeedBoost), duration);
 }
 
 void Player::setIceTime(float duration) {
-    iceTimer_ = std::max(iceTimer_, duration);
+    timers_.start(timerId(Timer::Ice), duration);
 }
 
 void Player::bounce(float strength) {
@@ -446,6 +429,50 @@ void Player::setVelocityY(float vy) {
     velocity_.y = vy;
 }
 
+PlayerSnapshot Player::getSnapshot() const {
+    PlayerSnapshot snapshot;
+    snapshot.position = position_;
+    snapshot.velocity = velocity_;
+    snapshot.state = state_;
+    snapshot.runSpeed = runSpeed_;
+    snapshot.speedBoostMultiplier = speedBoostMultiplier_;
+    snapshot.clock = clock_;
+    snapshot.speedBoostTime = timers_.remaining(timerId(Timer::SpeedBoost));
+    snapshot.iceTime = timers_.remaining(timerId(Timer::Ice));
+    snapshot.slideTimer = slideTimer_;
+    snapshot.score = score_;
+    snapshot.jumpsUsed = jumpsUsed_;
+    snapshot.grounded = grounded_;
+    snapshot.facingRight = facingRight_;
+    snapshot.isSliding = isSliding_;
+    snapshot.spacePressed = spacePressed_;
+    snapshot.downPressed = downPressed_;
+    return snapshot;
+}
+
+void Player::restoreSnapshot(const PlayerSnapshot& snapshot) {
+    position_ = snapshot.position;
+    velocity_ = snapshot.velocity;
+    state_ = snapshot.state;
+    runSpeed_ = snapshot.runSpeed;
+    speedBoostMultiplier_ = snapshot.speedBoostMultiplier;
+    clock_ = snapshot.clock;
+    std::array<float, TimerWheel::kMaxTimers> remaining{};
+    remaining[timerId(Timer::SpeedBoost)] = snapshot.speedBoostTime;
+    remaining[timerId(Timer::Ice)] = snapshot.iceTime;
+    timers_.restore(clock_, remaining);
+    slideTimer_ = snapshot.slideTimer;
+    score_ = snapshot.score;
+    jumpsUsed_ = snapshot.jumpsUsed;
+    grounded_ = snapshot.grounded;
+    facingRight_ = snapshot.facingRight;
+    isSliding_ = snapshot.isSliding;
+    spacePressed_ = snapshot.spacePressed;
+    downPressed_ = snapshot.downPressed;
+    updateAnimation(0.0f);
+    sprite_.setPosition(position_);
+}
+
 void Player::render(sf::RenderWindow& window) {
     window.draw(sprite_);
 }
@@ -1,9 +1,9 @@
 ﻿#pragma once
 
 #include <SFML/Graphics.hpp>
-#include <SFML/Audio.hpp>
 #include "Animation.h"
 #include "ResourceManager.h"
+#include "TimerWheel.h"
 
 enum class PlayerState {
     Idle,
@@ -13,6 +13,26 @@ enum class PlayerState {
     Dead
 };
 
+// Plain-data copy of everything Player::update reads, used for rewind snapshots
+struct PlayerSnapshot {
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    PlayerState state = PlayerState::Idle;
+    float runSpeed = 0.0f;
+    float speedBoostMultiplier = 1.0f;
+    float clock = 0.0f;           // the player's timer clock
+    float speedBoostTime = 0.0f;  // seconds left
+    float iceTime = 0.0f;         // seconds left
+    float slideTimer = 0.0f;
+    int score = 0;
+    int jumpsUsed = 0;
+    bool grounded = false;
+    bool facingRight = true;
+    bool isSliding = false;
+    bool spacePressed = false;
+    bool downPressed = false;
+};
+
 class Player {
 public:
     Player();
@@ -22,6 +42,7 @@ public:
     void render(sf::RenderWindow& window);
 
     sf::FloatRect getBounds() const;
+    const sf::Sprite& getSprite() const { return sprite_; }
     sf::Vector2f getPosition() const;
     void setPosition(const sf::Vector2f& pos);
 
@@ -45,10 +66,23 @@ public:
     void setIceTime(float duration);
     void bounce(float strength);
     void setVelocityY(float vy);
+    sf::Vector2f getVelocity() const { return velocity_; }
+    bool hasSpeedBoost() const { return timers_.isActive(timerId(Timer::SpeedBoost)); }
 
     PlayerState getState() const { return state_; }
 
+    PlayerSnapshot getSnapshot() const;
+    void restoreSnapshot(const PlayerSnapshot& snapshot);
+
 private:
+    // Timed effects, by their id in timers_
+    enum class Timer : std::uint8_t {
+        SpeedBoost,
+        Ice  // slowed down after leaving an ice platform
+    };
+
+    static std::size_t timerId(Timer timer) { return static_cast<std::size_t>(timer); }
+
     void loadAnimations();
     void updateAnimation(float deltaTime);
     void applyPhysics(float deltaTime);
@@ -71,8 +105,8 @@ private:
     float smallJumpStrength_;
     float runSpeed_;
     float speedBoostMultiplier_;
-    float speedBoostTimer_;
-    float iceTimer_;
+    TimerWheel timers_;
+    float clock_;  // seconds of updates while alive, timers_'s clock
     float slideDuration_;
     float slideTimer_;
 
@@ -82,11 +116,6 @@ private:
 
     int score_;
 
-    // Sound effects
-    sf::Sound jumpSound_;
-    sf::Sound slideSound_;
-    sf::Sound deathSound_;
-
     // Input state
     bool spacePressed_;
     bool downPressed_;
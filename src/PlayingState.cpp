@@ -3,57 +3,132 @@
 #include "PauseState.h"
 #include "GameOverState.h"
 #include "ResourceManager.h"
+#include "SoundMixer.h"
+#include "ScoreStore.h"
 #include <algorithm>
 #include <cmath>
-#include <fstream>
+#include <ctime>
+#include <iterator>
+#include <limits>
+#include <random>
 #include <sstream>
 
 namespace {
-    float randomFloat(std::mt19937& rng, float minValue, float maxValue) {
-        std::uniform_real_distribution<float> dist(minValue, maxValue);
-        return dist(rng);
+    const float kSnapshotInterval = 0.2f;     // five snapshots per second
+    const std::size_t kSnapshotHistory = 50;  // ten seconds of history
+    const float kRewindSeconds = 3.0f;
+
+    const float kViewWidth = 1280.0f;
+    const float kGenerationLookahead = 2400.0f;
+    const float kMaterializeAhead = 300.0f;  // past the right edge of the view
+    const float kCleanupDistance = 900.0f;
+    const float kMaxChunkOverhang = 140.0f;  // widest moving-platform swing
+    const float kComboWindow = 2.5f;         // seconds to extend a combo
+
+    // Distance-paced spawns; flyers take over from walkers after a minute
+    const float kForever = std::numeric_limits<float>::infinity();
+    const SpawnRule kSpawnRules[] = {
+        { SpawnAction::WalkerEnemy,  SpawnClock::Distance, 70.0f, 0.0f,  60.0f },
+        { SpawnAction::FlyerEnemy,   SpawnClock::Distance, 70.0f, 60.0f, kForever },
+        { SpawnAction::GoldenCarrot, SpawnClock::Distance, 50.0f, 0.0f,  kForever },
+        { SpawnAction::CoinPair,     SpawnClock::Distance, 30.0f, 0.0f,  kForever },
+    };
+
+    const float kContactSlop = 4.0f;  // ground contact allowance for rounding
+
+    struct SweepHit {
+        float time = 2.0f;     // fraction of the motion at first contact; above 1 means none
+        float normalY = 0.0f;  // -1 landed on top, 1 hit the underside, 0 side
+    };
+
+    // Entry and exit times of a moving interval [min, max) against a fixed
+    // one along one axis. Returns false if they can never overlap.
+    bool sweepAxis(float min, float max, float motion, float targetMin, float targetMax, float& entry, float& exit) {
+        if (motion == 0.0f) {
+            if (max <= targetMin || min >= targetMax) return false;
+            entry = -std::numeric_limits<float>::infinity();
+            exit = std::numeric_limits<float>::infinity();
+            return true;
+        }
+        float first = (targetMin - max) / motion;
+        float second = (targetMax - min) / motion;
+        entry = std::min(first, second);
+        exit = std::max(first, second);
+        return true;
     }
 
-    int randomInt(std::mt19937& rng, int minValue, int maxValue) {
-        std::uniform_int_distribution<int> dist(minValue, maxValue);
-        return dist(rng);
+    // Swept AABB test of box moving by motion against a fixed target. Boxes
+    // that already overlap at the start do not count as a hit.
+    SweepHit sweepAabb(const sf::FloatRect& box, const sf::Vector2f& motion, const sf::FloatRect& target) {
+        SweepHit hit;
+        float entryX, exitX, entryY, exitY;
+        if (!sweepAxis(box.left, box.left + box.width, motion.x, target.left, target.left + target.width, entryX, exitX) ||
+            !sweepAxis(box.top, box.top + box.height, motion.y, target.top, target.top + target.height, entryY, exitY)) {
+            return hit;
+        }
+        float entry = std::max(entryX, entryY);
+        float exit = std::min(exitX, exitY);
+        if (entry > exit || entry < 0.0f || entry > 1.0f) return hit;
+        hit.time = entry;
+        if (entryY >= entryX) {
+            hit.normalY = motion.y > 0.0f ? -1.0f : 1.0f;
+        }
+        return hit;
+    }
+
+    std::uint16_t damageTelemetry(DamageSource source) {
+        switch (source) {
+        case DamageSource::Ceiling:    return TelemetryEvents::DamageCeiling;
+        case DamageSource::Enemy:      return TelemetryEvents::DamageEnemy;
+        case DamageSource::Projectile: return TelemetryEvents::DamageProjectile;
+        case DamageSource::Cactus:     return TelemetryEvents::DamageCactus;
+        case DamageSource::Count:      break;
+        }
+        return 0;
+    }
+
+    // Appends live objects to a fixed snapshot array; returns false if some did not fit
+    template <typename Container, typename Array, typename Capture>
+    bool captureInto(const Container& source, Array& target, std::size_t& count, Capture capture) {
+        for (const auto& item : source) {
+            if (count == target.size()) return false;
+            target[count++] = capture(item);
+        }
+        return true;
     }
 }
 
 PlayingState::PlayingState()
-    : cameraX_(0.0f)
+    : spawnScheduler_(kSpawnRules, std::size(kSpawnRules))
+    , lives_(3)
+    , cameraX_(0.0f)
     , cameraSmoothX_(0.0f)
     , cameraShakeOffset_(0.0f, 0.0f)
     , cameraShakeTime_(0.0f)
     , cameraShakeIntensity_(0.0f)
-    , generationX_(800.0f)
-    , groundGenerationX_(0.0f)
-    , comboTimer_(0.0f)
     , comboCount_(0)
     , scoreMultiplier_(1.0f)
-    , doublePointsTimer_(0.0f)
-    , magnetTimer_(0.0f)
-    , shieldTimer_(0.0f)
     , magnetRadius_(220.0f)
     , highScore_(0)
     , distance_(0.0f)
-    , platformMinGap_(120.0f)
-    , platformMaxGap_(260.0f)
     , difficultyTimer_(0.0f)
     , enemySpawnTimer_(0.0f)
     , projectileSpeed_(420.0f)
     , playerBaseSpeed_(240.0f)
-    , lastEnemyBatchDistance_(0.0f)
-    , lastGoldenCarrotDistance_(0.0f)
-    , lastCoinDistance_(0.0f)
     , paused_(false)
     , magnetActive_(false)
     , shieldActive_(false)
     , doublePointsActive_(false)
     , worldTime_(0.0f)
-    , rng_(std::random_device{}())
-    , font_(nullptr)
-    , lives_(3) {
+    , difficulty_(1.0f)
+    , runSeed_(std::random_device{}())
+    , rng_(runSeed_)
+    , snapshots_(kSnapshotHistory)
+    , snapshotTimer_(0.0f)
+    , tick_(0)
+    , pendingEvents_(0)
+    , showLodStats_(false)
+    , font_(nullptr) {
 
     auto& rm = ResourceManager::getInstance();
 
@@ -72,48 +147,51 @@ PlayingState::PlayingState()
         pauseText_.setString("PAUSED\nPress P to Resume");
         pauseText_.setPosition(640.0f - pauseText_.getGlobalBounds().width / 2.0f,
             360.0f - pauseText_.getGlobalBounds().height / 2.0f);
-    }
 
-    if (rm.hasSoundBuffer("collect")) {
-        collectSound_.setBuffer(rm.getSoundBuffer("collect"));
-        collectSound_.setVolume(55.0f);
-    }
-    if (rm.hasSoundBuffer("enemy_hit")) {
-        enemyHitSound_.setBuffer(rm.getSoundBuffer("enemy_hit"));
-        enemyHitSound_.setVolume(48.0f);
-    }
-    if (rm.hasSoundBuffer("hit")) {
-        hitSound_.setBuffer(rm.getSoundBuffer("hit"));
-        hitSound_.setVolume(55.0f);
-    }
-    if (rm.hasSoundBuffer("ouch")) {
-        ouchSound_.setBuffer(rm.getSoundBuffer("ouch"));
-        ouchSound_.setVolume(55.0f);
+        lodText_.setFont(*font_);
+        lodText_.setCharacterSize(16);
+        lodText_.setFillColor(sf::Color::White);
+        lodText_.setOutlineColor(sf::Color::Black);
+        lodText_.setOutlineThickness(1.0f);
+        lodText_.setPosition(10.0f, 690.0f);
     }
 
     player_.setRunSpeed(playerBaseSpeed_);
-    highScore_ = loadHighScore();
-
-    ensureGround();
-    ensurePlatforms();
+    telemetry_ = std::make_unique<TelemetryRecorder>(runSeed_, static_cast<std::int64_t>(std::time(nullptr)));
+    highScore_ = ScoreStore::getInstance().getHighScore();
+
+    DecorationMetrics metrics;
+    for (std::size_t i = 0; i < metrics.sizes.size(); ++i) {
+        const char* name = decorationTextureName(static_cast<DecorationKind>(i));
+        metrics.available[i] = rm.hasTexture(name);
+        if (metrics.available[i]) {
+            metrics.sizes[i] = sf::Vector2f(rm.getTexture(name).getSize());
+        }
+    }
+    generator_ = std::make_unique<WorldGenerator>(runSeed_, metrics);
+    ensureChunks();
 
     // Setup clouds in the sky
     auto& rmCloud = ResourceManager::getInstance();
     if (rmCloud.hasTexture("cloud")) {
         for (int i = 0; i < 5; ++i) {
-            sf::Sprite cloud(rmCloud.getTexture("cloud"));
-            float scale = randomFloat(rng_, 0.6f, 1.0f);
-            cloud.setScale(scale, scale);
-            float x = randomFloat(rng_, 0.0f, 1600.0f);
-            float y = randomFloat(rng_, 60.0f, 220.0f);
-            cloud.setPosition(x, y);
-            clouds_.push_back(cloud);
-            cloudSpeeds_.push_back(randomFloat(rng_, 20.0f, 40.0f));
+            SpriteRef sprite;
+            sprite.layer = RenderLayer::Sky;
+            sprite.texture = &rmCloud.getTexture("cloud");
+            sprite.scale = rng_.uniform(0.6f, 1.0f);
+            float x = rng_.uniform(0.0f, 1600.0f);
+            float y = rng_.uniform(60.0f, 220.0f);
+            std::size_t cloud = entities_.create(Behavior::Cloud, sf::Vector2f(x, y));
+            entities_.setSprite(cloud, sprite);
+            entities_.setVelocity(cloud, sf::Vector2f(-rng_.uniform(20.0f, 40.0f), 0.0f));
         }
     }
 }
 
-PlayingState::~PlayingState() = default;
+PlayingState::~PlayingState() {
+    // Game over destroys this state on the sim thread, which must not wait on disk
+    TelemetryRecorder::retire(std::move(telemetry_));
+}
 
 void PlayingState::handleInput(sf::Event& event) {
     if (event.type == sf::Event::KeyPressed) {
@@ -123,6 +201,13 @@ void PlayingState::handleInput(sf::Event& event) {
                 game_->pushState(std::make_unique<PauseState>());
             }
         }
+        else if (event.key.code == sf::Keyboard::F3) {
+            showLodStats_ = !showLodStats_;
+        }
+        else if (!paused_ && event.key.code == sf::Keyboard::R) {
+            // Practice mode: jump back a few seconds
+            rewind(kRewindSeconds);
+        }
         else if (!paused_) {
             player_.handleInput(event.key.code, true);
         }
@@ -143,104 +228,86 @@ void PlayingState::update(float deltaTime) {
     float currentDistance = std::max(0.0f, (player_.getPosition().x - 100.0f) / 50.0f);
     distance_ = std::max(distance_, currentDistance);
 
-    ensureGround();
-    ensurePlatforms();
+    ensureChunks();
     cleanupOldEntities();
 
     updateDifficulty();
-    updatePowerUps(deltaTime);
+    updateEffects();
     updateCamera();
+    materializeSpawns();
     background_.update(deltaTime, cameraX_);
 
-    // Distance-based spawns for more predictable pacing
-    // 1) Enemies: at most ONE enemy on screen, spawned every ~70m
-    if (distance_ - lastEnemyBatchDistance_ >= 70.0f) {
-        spawnEnemy();
-        lastEnemyBatchDistance_ = distance_;
-    }
-
-    // 2) Golden carrot (x2) every 50m on ground
-    if (distance_ - lastGoldenCarrotDistance_ >= 50.0f) {
-        float x = player_.getPosition().x + 450.0f;
-        float y = 570.0f; // on ground surface
-        collectibles_.push_back(std::make_unique<Collectible>(sf::Vector2f(x, y), CollectibleType::Gem));
-        lastGoldenCarrotDistance_ = distance_;
-    }
+    // Distance- and time-paced spawns (see kSpawnRules)
+    spawnScheduler_.poll(distance_, worldTime_, [&](const SpawnRule& rule) { runSpawnRule(rule); });
 
-    // 3) Coin line every ~30m on ground
-    if (distance_ - lastCoinDistance_ >= 30.0f) {
-        float startX = player_.getPosition().x + 400.0f;
-        float y = 570.0f; // on ground surface
-        int count = 2;
-        for (int i = 0; i < count; ++i) {
-            float x = startX + static_cast<float>(i) * 40.0f;
-            collectibles_.push_back(std::make_unique<Collectible>(sf::Vector2f(x, y), CollectibleType::Heart)); // using coin_gold as coin
-        }
-        lastCoinDistance_ = distance_;
-    }
-
-    for (auto& platform : platforms_) {
-        platform->update(deltaTime);
-    }
-
-    for (auto& enemy : enemies_) {
-        enemy->setTargetPosition(player_.getPosition());
-        enemy->update(deltaTime);
-        if (enemy->wantsToShoot()) {
-            Projectile projectile;
-            projectile.shape.setRadius(10.0f);
-            projectile.shape.setOrigin(10.0f, 10.0f);
-            projectile.shape.setFillColor(sf::Color(255, 140, 140));
-            projectile.shape.setPosition(enemy->getShootOrigin());
-            projectile.velocity = sf::Vector2f(-projectileSpeed_, 0.0f);
-            projectile.active = true;
-            projectiles_.push_back(projectile);
+    // Content far ahead of the view updates coarsely or sleeps
+    lod_.beginTick(cameraX_ + kViewWidth);
+    for (auto& chunk : chunks_) {
+        for (auto& platform : chunk.platforms) {
+            // A skipped moving platform may now be up to twice its range left of where it was drawn
+            if (lod_.shouldUpdate(platform.getBounds().left - 2.0f * kMaxChunkOverhang)) {
+                platform.update(worldTime_, deltaTime);
+            }
         }
     }
 
-    // Update clouds to drift slowly across the sky
-    for (std::size_t i = 0; i < clouds_.size(); ++i) {
-        clouds_[i].move(-cloudSpeeds_[i] * deltaTime, 0.0f);
-        if (clouds_[i].getPosition().x < cameraX_ - 300.0f) {
-            float newX = cameraX_ + 1500.0f;
-            float newY = randomFloat(rng_, 60.0f, 220.0f);
-            clouds_[i].setPosition(newX, newY);
-        }
+    enemyShots_.clear();
+    enemies_.update(worldTime_, deltaTime, player_.getPosition(), enemyShots_, lod_);
+    for (const auto& origin : enemyShots_) {
+        spawnProjectile(origin, sf::Vector2f(-projectileSpeed_, 0.0f));
     }
 
-    for (auto& collectible : collectibles_) {
-        if (magnetActive_) {
-            float dx = collectible->getPosition().x - player_.getPosition().x;
-            if (std::abs(dx) < magnetRadius_) {
-                collectible->attractTowards(player_.getPosition(), 700.0f, deltaTime);
-            }
+    MagnetPull magnet;
+    magnet.active = magnetActive_;
+    magnet.target = player_.getPosition();
+    magnet.radius = magnetRadius_;
+    magnet.strength = 700.0f;
+    for (auto& chunk : chunks_) {
+        // The magnet only reaches items near the player, which are always in a full-rate chunk
+        if (lod_.shouldUpdate(chunk.startX(), chunk.collectibles.size())) {
+            chunk.collectibles.update(worldTime_, deltaTime, magnet);
         }
-        collectible->update(deltaTime);
     }
 
-    handleProjectiles(deltaTime);
-    updateScorePopups(deltaTime);
-    checkCollisions(prevPlayerBounds);
+    updateEntities(deltaTime);
+    checkCollisions(prevPlayerBounds, deltaTime);
+    processEvents();
 
-    enemies_.erase(std::remove_if(enemies_.begin(), enemies_.end(),
-        [](const std::unique_ptr<Enemy>& e) { return !e->isActive(); }),
-        enemies_.end());
+    recordTelemetry(deltaTime);
 
-    collectibles_.erase(std::remove_if(collectibles_.begin(), collectibles_.end(),
-        [](const std::unique_ptr<Collectible>& c) { return !c->isActive(); }),
-        collectibles_.end());
+    snapshotTimer_ += deltaTime;
+    if (snapshotTimer_ >= kSnapshotInterval && !player_.isDead()) {
+        snapshotTimer_ = 0.0f;
+        captureSnapshot();
+    }
 
     if (player_.isDead()) {
-        if (player_.getScore() > highScore_) {
-            highScore_ = player_.getScore();
-            saveHighScore();
+        ScoreStore& scores = ScoreStore::getInstance();
+        if (scores.qualifies(player_.getScore())) {
+            LeaderboardEntry entry;
+            entry.score = player_.getScore();
+            entry.distance = distance_;
+            entry.seed = runSeed_;
+            entry.date = static_cast<std::int64_t>(std::time(nullptr));
+            scores.submit(entry);
         }
+        highScore_ = std::max(highScore_, player_.getScore());
         if (game_) {
             game_->changeState(std::make_unique<GameOverState>(player_.getScore(), highScore_, distance_));
         }
         return;
     }
 
+    // The store may finish loading after this state was created
+    highScore_ = std::max(highScore_, ScoreStore::getInstance().getHighScore());
+
+    if (showLodStats_) {
+        const LodCounters& counters = lod_.getCounters();
+        lodText_.setString("LOD  updated " + std::to_string(counters.updated) +
+            "  skipped " + std::to_string(counters.skipped) +
+            "  next spawn " + std::to_string(static_cast<int>(spawnScheduler_.nextDue(SpawnClock::Distance))) + "m");
+    }
+
     const float comboMultiplier = 1.0f + static_cast<float>(comboCount_) * 0.1f;
     hud_.update(player_.getScore(),
         highScore_,
@@ -261,30 +328,27 @@ void PlayingState::render(sf::RenderWindow& window) {
     background_.render(window);
 
     // Parallax clouds in front of distant background
-    for (const auto& cloud : clouds_) {
-        window.draw(cloud);
-    }
-
-    for (const auto& platform : platforms_) {
-        platform->render(window);
+    entities_.render(window, RenderLayer::Sky, font_);
+
+    const float viewLeft = view.getCenter().x - view.getSize().x / 2.0f;
+    const float viewRight = viewLeft + view.getSize().x;
+    for (auto& chunk : chunks_) {
+        chunk.ground.render(window, viewLeft, viewRight);
+        for (auto& platform : chunk.platforms) {
+            platform.render(window);
+        }
     }
 
     // Ground decorations (cactus, mushrooms)
-    for (const auto& deco : decorations_) {
-        window.draw(deco.sprite);
-    }
+    decorations_.render(window, viewLeft, viewRight);
 
-    for (const auto& collectible : collectibles_) {
-        collectible->render(window);
+    for (const auto& chunk : chunks_) {
+        chunk.collectibles.render(window);
     }
 
-    for (const auto& enemy : enemies_) {
-        enemy->render(window);
-    }
+    enemies_.render(window);
 
-    for (const auto& projectile : projectiles_) {
-        window.draw(projectile.shape);
-    }
+    entities_.render(window, RenderLayer::World, font_);
 
     player_.render(window);
 
@@ -298,13 +362,14 @@ void PlayingState::render(sf::RenderWindow& window) {
         window.draw(aura);
     }
 
-    for (const auto& popup : scorePopups_) {
-        window.draw(popup.text);
-    }
+    entities_.render(window, RenderLayer::Overlay, font_);
 
     view.setCenter(640.0f, 360.0f);
     window.setView(view);
     hud_.render(window);
+    if (showLodStats_ && font_) {
+        window.draw(lodText_);
+    }
 
     // Gameplay uses normal OS cursor
     window.setMouseCursorVisible(true);
@@ -317,140 +382,136 @@ void PlayingState::render(sf::RenderWindow& window) {
     }
 }
 
-void PlayingState::spawnEnemy() {
+void PlayingState::runSpawnRule(const SpawnRule& rule) {
+    switch (rule.action) {
+    case SpawnAction::WalkerEnemy:
+        spawnEnemy(EnemyType::Walker);
+        break;
+    case SpawnAction::FlyerEnemy:
+        spawnEnemy(EnemyType::Flyer);
+        break;
+    case SpawnAction::GoldenCarrot: {
+        float x = player_.getPosition().x + 450.0f;
+        float y = 570.0f; // on ground surface
+        chunkAt(x).collectibles.add(sf::Vector2f(x, y), CollectibleType::Gem);
+        break;
+    }
+    case SpawnAction::CoinPair: {
+        float startX = player_.getPosition().x + 400.0f;
+        float y = 570.0f; // on ground surface
+        int count = 2;
+        for (int i = 0; i < count; ++i) {
+            float x = startX + static_cast<float>(i) * 40.0f;
+            chunkAt(x).collectibles.add(sf::Vector2f(x, y), CollectibleType::Heart); // using coin_gold as coin
+        }
+        break;
+    }
+    }
+}
+
+void PlayingState::spawnEnemy(EnemyType type) {
     // Limit total enemies on screen so it doesn't feel overwhelming
     const std::size_t maxEnemiesOnScreen = 1;
     if (enemies_.size() >= maxEnemiesOnScreen) return;
 
     float difficulty = 1.0f + player_.getScore() / 900.0f;
+    bool spawnFlyer = (type == EnemyType::Flyer);
 
-    // Randomly choose between a ground walker and a flying enemy in the sky
-    // After 1 minute, start spawning flyers (copters)
-    bool spawnFlyer = (worldTime_ >= 60.0f);
-
-    EnemyType type = spawnFlyer ? EnemyType::Flyer : EnemyType::Walker;
-
-    float x = cameraX_ + 900.0f + randomFloat(rng_, 0.0f, 250.0f);
+    float x = cameraX_ + 900.0f + rng_.uniform(0.0f, 250.0f);
     float y = spawnFlyer
-        ? randomFloat(rng_, 260.0f, 360.0f)   // flyMan in mid-sky
+        ? rng_.uniform(260.0f, 360.0f)   // flyMan in mid-sky
         : 540.0f;                             // ground runner
 
     // Enemies run slightly faster than player but not too fast
     float base = player_.getRunSpeed() * 1.05f;
     float speed = base * (0.9f + 0.2f * difficulty);
 
-    auto enemy = std::make_unique<Enemy>(sf::Vector2f(x, y), type, speed);
-    enemy->setTargetPosition(player_.getPosition());
-    enemies_.push_back(std::move(enemy));
-}
-
-void PlayingState::spawnCollectiblePattern(const Platform& platform) {
-    if (platform.getSize().x < 120.0f) return;
-
-    float topY = platform.getPosition().y - 18.0f;
-    int count = std::clamp(static_cast<int>(platform.getSize().x / 60.0f), 2, 7);
-    float startX = platform.getPosition().x + 20.0f;
-    float step = (platform.getSize().x - 40.0f) / std::max(1, count - 1);
-    float roll = randomFloat(rng_, 0.0f, 1.0f);
-
-    auto placeCollectible = [&](const sf::Vector2f& pos, CollectibleType type) {
-        collectibles_.push_back(std::make_unique<Collectible>(pos, type));
-        };
-
-    if (roll < 0.5f) {
-        // Simple, readable horizontal line of carrots
-        for (int i = 0; i < count; ++i) {
-            placeCollectible({ startX + step * i, topY }, CollectibleType::Coin);
-        }
-    }
-    else if (roll < 0.85f) {
-        // Gentle zig-zag carrots across the platform
-        for (int i = 0; i < count; ++i) {
-            float zigzag = (i % 2 == 0) ? -18.0f : 12.0f;
-            placeCollectible({ startX + step * i, topY + zigzag }, CollectibleType::Coin);
-        }
-    }
-    else {
-        // Small cluster of golden carrots near the far end for higher risk/reward
-        int gems = std::min(3, count);
-        float baseX = startX + step * (count - 1) - 30.0f;
-        for (int i = 0; i < gems; ++i) {
-            float offsetX = randomFloat(rng_, -10.0f, 20.0f);
-            float offsetY = -randomFloat(rng_, 0.0f, 16.0f);
-            placeCollectible({ baseX + offsetX, topY + offsetY }, CollectibleType::Gem);
-        }
-    }
-
-    if (randomFloat(rng_, 0.0f, 1.0f) < 0.18f) {
-        CollectibleType powerType = CollectibleType::Magnet;
-        float powerRoll = randomFloat(rng_, 0.0f, 1.0f);
-        if (powerRoll < 0.25f) powerType = CollectibleType::Magnet;
-        else if (powerRoll < 0.5f) powerType = CollectibleType::Shield;
-        else if (powerRoll < 0.75f) powerType = CollectibleType::SpeedBoost;
-        else powerType = CollectibleType::DoublePoints;
-
-        placeCollectible({ platform.getPosition().x + platform.getSize().x / 2.0f, topY - 24.0f }, powerType);
-    }
+    enemies_.spawn(type, sf::Vector2f(x, y), speed, worldTime_);
 }
 
-void PlayingState::checkCollisions(const sf::FloatRect& prevPlayerBounds) {
+void PlayingState::checkCollisions(const sf::FloatRect& prevPlayerBounds, float deltaTime) {
     sf::FloatRect playerBounds = player_.getBounds();
     bool grounded = false;
 
-    for (auto& platform : platforms_) {
-        if (!platform->isActive()) continue;
-        sf::FloatRect platformBounds = platform->getBounds();
-        if (playerBounds.intersects(platformBounds)) {
-            float prevBottom = prevPlayerBounds.top + prevPlayerBounds.height;
-            float platformTop = platformBounds.top;
-            float currBottom = playerBounds.top + playerBounds.height;
-
-            // Only treat as a landing if the player was above the platform last frame
-            // and is now crossing its top from above (prevents "sticking" to sides).
-            // Allow a bit more tolerance so it's easier to land on mid-air platforms.
-            bool comingFromAbove = prevBottom <= platformTop + 20.0f;
-            bool movingDown = currBottom >= prevBottom;
-
-            if (comingFromAbove && movingDown && currBottom > platformTop) {
-                player_.setPosition({ player_.getPosition().x, platformTop - playerBounds.height });
-                grounded = true;
-                platform->applyTypeEffect(player_);
-                // Refresh bounds after snapping
-                playerBounds = player_.getBounds();
-            }
-
-            // Collision from below
-            float prevTop = prevPlayerBounds.top;
-            float platformBottom = platformBounds.top + platformBounds.height;
-            float currTop = playerBounds.top;
-            bool comingFromBelow = prevTop >= platformBottom - 20.0f;
-            bool movingUp = currTop <= prevTop;
-
-            if (comingFromBelow && movingUp && currTop < platformBottom) {
-                player_.setPosition({ player_.getPosition().x, platformBottom });
-                player_.setVelocityY(200.0f); // Bounce down
-                if (lives_ > 1) {
-                    lives_--;
-                    hud_.updateLives(lives_);
-                    ouchSound_.play();
-                }
-                else {
-                    player_.die();
+    // Sweep the player's hitbox over this tick's motion against every platform
+    // and resolve only the earliest top or underside hit, so no step is long
+    // enough to pass through one. Motion is taken relative to each platform,
+    // which catches platforms rising into the player as well. Side hits are
+    // ignored, as before, so the player never sticks to a platform's edge.
+    auto resolvePlatforms = [&]() {
+        const float prevBottom = prevPlayerBounds.top + prevPlayerBounds.height;
+        // Start box uses the current size in case the hitbox changed this tick (sliding)
+        const sf::FloatRect start(prevPlayerBounds.left, prevBottom - playerBounds.height,
+            playerBounds.width, playerBounds.height);
+        const sf::Vector2f motion(playerBounds.left - start.left, playerBounds.top - start.top);
+
+        Platform* hitPlatform = nullptr;
+        SweepHit first;
+        for (auto& chunk : chunks_) {
+            for (std::size_t i = 0; i < chunk.platforms.size(); ++i) {
+                Platform& platform = chunk.platforms[i];
+                if (!platform.isActive()) continue;
+                sf::Vector2f platformMotion = platform.getPosition() - platform.positionAt(worldTime_ - deltaTime);
+                sf::FloatRect platformStart = platform.getBounds();
+                platformStart.left -= platformMotion.x;
+                platformStart.top -= platformMotion.y;
+                SweepHit hit = sweepAabb(start, motion - platformMotion, platformStart);
+                if (hit.normalY == 0.0f || hit.time >= first.time) continue;
+                first = hit;
+                hitPlatform = &platform;
+                if (hit.normalY < 0.0f) {
+                    contact_.active = true;
+                    contact_.chunkIndex = chunk.index;
+                    contact_.platformIndex = i;
+                    contact_.platformPosition = platform.getPosition();
                 }
-                // Refresh bounds after snapping
-                playerBounds = player_.getBounds();
             }
         }
+        if (!hitPlatform) return;
+
+        sf::FloatRect platformBounds = hitPlatform->getBounds();
+        sf::Vector2f position = player_.getPosition();
+        if (first.normalY < 0.0f) {
+            // Landed on top
+            player_.setPosition({ position.x, position.y + platformBounds.top - (playerBounds.top + playerBounds.height) });
+            grounded = true;
+            hitPlatform->applyTypeEffect(player_);
+            playerBounds = player_.getBounds();
+            return;
+        }
+
+        // Hit the underside
+        contact_ = PlatformContact();
+        player_.setPosition({ position.x, position.y + platformBounds.top + platformBounds.height - playerBounds.top });
+        player_.setVelocityY(200.0f); // Bounce down
+        events_.addDamage(DamageSource::Ceiling);
+        playerBounds = player_.getBounds();
+    };
+
+    // Standing on the same platform as last tick needs no search. Otherwise
+    // rediscover the support from scratch and remember it for next tick.
+    if (holdContact(playerBounds)) {
+        grounded = true;
+    }
+    else {
+        contact_ = PlatformContact();
+        resolvePlatforms();
     }
 
-    // Simple safety: treat the main ground band as solid if the player is very close,
-    // so the bunny does not fall through due to tiny numerical gaps.
+    // Ground: look up the heightfield under the player's feet. The player can
+    // straddle a chunk boundary, so ask the chunk under each edge. Ground runs
+    // are deeper than any step, so a crossing test is enough here.
     if (!grounded) {
-        const float groundTopY = 600.0f;
+        float left = playerBounds.left;
+        float right = playerBounds.left + playerBounds.width;
+        float groundTopY = std::min(chunkAt(left).ground.topUnder(left, right),
+            chunkAt(right).ground.topUnder(left, right));
         float playerBottom = playerBounds.top + playerBounds.height;
-        if (playerBottom >= groundTopY - 4.0f && playerBottom <= groundTopY + 20.0f) {
-            float snapY = groundTopY - playerBounds.height;
-            player_.setPosition({ player_.getPosition().x, snapY });
+        float prevBottom = prevPlayerBounds.top + prevPlayerBounds.height;
+        if (groundTopY != GroundHeightfield::kNoGround &&
+            playerBottom >= groundTopY - kContactSlop && prevBottom <= groundTopY + kContactSlop) {
+            sf::Vector2f position = player_.getPosition();
+            player_.setPosition({ position.x, position.y + groundTopY - playerBottom });
             grounded = true;
             playerBounds = player_.getBounds();
         }
@@ -458,139 +519,183 @@ void PlayingState::checkCollisions(const sf::FloatRect& prevPlayerBounds) {
 
     player_.setGrounded(grounded);
 
-    comboTimer_ += 1.0f / 60.0f;
-    if (comboTimer_ > 2.5f) {
-        comboTimer_ = 0.0f;
-        comboCount_ = 0;
-    }
-
-    for (auto& collectible : collectibles_) {
-        if (collectible->isActive() && playerBounds.intersects(collectible->getBounds())) {
-            collectible->collect();
-            if (collectible->isPowerUp()) {
-                switch (collectible->getType()) {
-                case CollectibleType::Magnet:
-                    magnetActive_ = true;
-                    magnetTimer_ = 10.0f;
-                    break;
-                case CollectibleType::Shield:
-                    shieldActive_ = true;
-                    shieldTimer_ = 8.0f;
-                    break;
-                case CollectibleType::SpeedBoost:
-                    player_.applySpeedBoost(2.0f, 5.0f);
-                    break;
-                case CollectibleType::DoublePoints:
-                    doublePointsActive_ = true;
-                    doublePointsTimer_ = 15.0f;
-                    break;
-                default:
-                    break;
-                }
-            }
-            else {
-                comboCount_++;
-                comboTimer_ = 0.0f;
-                int basePoints = collectible->getPoints();
-                float comboMultiplier = 1.0f + static_cast<float>(comboCount_) * 0.1f;
-                if (doublePointsActive_) comboMultiplier *= 2.0f;
-                int gained = static_cast<int>(std::round(basePoints * comboMultiplier));
-                player_.addScore(gained);
-                addScorePopup(collectible->getPosition(), gained);
-            }
-            collectSound_.play();
-        }
-    }
-
-    for (auto& enemy : enemies_) {
-        if (!enemy->isActive()) continue;
-        if (playerBounds.intersects(enemy->getBounds())) {
-            if (player_.getState() == PlayerState::Sliding || shieldActive_) {
-                enemy->setActive(false);
-                player_.addScore(50);
-                comboCount_++;
-                comboTimer_ = 0.0f;
-                triggerScreenShake(6.0f, 0.2f);
-                if (shieldActive_) {
-                    shieldActive_ = false;
-                    shieldTimer_ = 0.0f;
-                }
-                addScorePopup(enemy->getPosition(), 50);
-                enemyHitSound_.play();
+    // Broad phase: test the player's sprite box against every collectible,
+    // enemy, projectile and decoration in one batch. Entries are laid out in
+    // that order, and each loop below walks its own range of the hit mask.
+    // Textured hits are then confirmed pixel by pixel against the sprites.
+    const sf::Sprite& playerSprite = player_.getSprite();
+    broadphase_.clear();
+    projectileSlots_.clear();
+    for (const auto& chunk : chunks_) {
+        chunk.collectibles.appendBounds(broadphase_);
+    }
+    enemies_.appendBounds(broadphase_);
+    for (std::size_t i = 0; i < entities_.size(); ++i) {
+        if (!entities_.is(i, Behavior::Projectile)) continue;
+        projectileSlots_.push_back(i);
+        broadphase_.push(entities_.getBounds(i));
+    }
+    const sf::FloatRect playerBox = playerSprite.getGlobalBounds();
+    const auto nearbyDecorations = decorations_.range(playerBox.left, playerBox.left + playerBox.width);
+    for (std::size_t i = nearbyDecorations.first; i < nearbyDecorations.second; ++i) {
+        broadphase_.push(decorations_.getBounds(i));
+    }
+    broadphase_.intersect(playerBox, broadphaseHits_);
+    if (!broadphaseHits_.any()) return;
+    std::size_t slot = 0;
+
+    for (auto& chunk : chunks_) {
+        CollectibleField& collectibles = chunk.collectibles;
+        const std::size_t first = slot;
+        slot += collectibles.size();
+        // Back to front, so a swap-remove only moves an item already handled
+        for (std::size_t i = collectibles.size(); i-- > 0;) {
+            if (!broadphaseHits_.test(first + i) || !spritesOverlap(playerSprite, collectibles.getSprite(i))) continue;
+            if (collectibles.isPowerUp(i)) {
+                events_.push(GameEvent::powerUpStarted(collectibles.getType(i), collectibles.getPosition(i)));
             }
             else {
-                if (lives_ > 0) {
-                    lives_--;
-                    hud_.updateLives(lives_);
-                    ouchSound_.play();
-                }
-                else {
-                    player_.die();
-                }
+                events_.push(GameEvent::collected(collectibles.getType(i), collectibles.getPosition(i)));
             }
+            collectibles.remove(i);
         }
     }
 
-    for (auto& projectile : projectiles_) {
-        if (!projectile.active) continue;
-        if (playerBounds.intersects(projectile.shape.getGlobalBounds())) {
-            projectile.active = false;
-            if (shieldActive_) {
-                shieldActive_ = false;
-                shieldTimer_ = 0.0f;
-            }
-            else {
-                if (lives_ > 1) {
-                    lives_--;
-                    hud_.updateLives(lives_);
-                    ouchSound_.play();
-                }
-                else {
-                    player_.die();
-                }
-            }
+    const std::size_t firstEnemy = slot;
+    slot += enemies_.size();
+    enemies_.removeIf([&](const EnemyBody& enemy, EnemyType type, std::size_t enemySlot) {
+        if (!broadphaseHits_.test(firstEnemy + enemySlot)) return false;
+        if (!spritesOverlap(playerSprite, getEnemySprite(type, enemy))) return false;
+        if (player_.getState() == PlayerState::Sliding || shieldActive_) {
+            events_.push(GameEvent::enemyKilled(enemy.position, shieldActive_));
+            return true;
+        }
+        events_.addDamage(DamageSource::Enemy);
+        return false;
+    });
+
+    // Projectiles are untextured circles, so they keep the player's hitbox
+    for (std::size_t i : projectileSlots_) {
+        if (broadphaseHits_.test(slot++) && playerBounds.intersects(entities_.getBounds(i))) {
+            entities_.destroy(i);
+            events_.addDamage(DamageSource::Projectile);
         }
     }
 
-    // Cactus & mushrooms: decorations with gameplay effects
-    for (const auto& deco : decorations_) {
-        const sf::Texture* tex = deco.sprite.getTexture();
-        if (!tex) continue;
-        if (!playerBounds.intersects(deco.sprite.getGlobalBounds())) continue;
-
-        auto& rm = ResourceManager::getInstance();
-        bool isCactus = rm.hasTexture("cactus") && (tex == &rm.getTexture("cactus"));
-        bool isBrownMushroom = rm.hasTexture("decor_mushroom") && (tex == &rm.getTexture("decor_mushroom"));
-        bool isRedMushroom = rm.hasTexture("mushroom_red") && (tex == &rm.getTexture("mushroom_red"));
-
-        if (isRedMushroom) {
-            // Red mushrooms are safe: no effect
-            continue;
+    // Decorations near the player; what they do comes from the kind's traits
+    for (std::size_t i = nearbyDecorations.first; i < nearbyDecorations.second; ++i) {
+        if (!broadphaseHits_.test(slot++) || !spritesOverlap(playerSprite, decorations_.getSprite(i))) continue;
+        const DecorationTraits& traits = decorationTraits(decorations_.getKind(i));
+        switch (traits.behavior) {
+        case DecorationBehavior::Damage:
+            events_.addDamage(DamageSource::Cactus);
+            break;
+        case DecorationBehavior::ScorePenalty:
+            events_.push(GameEvent::penalized(traits.penalty));
+            break;
+        case DecorationBehavior::None:
+            break;
         }
+    }
+}
 
-        if (isBrownMushroom) {
-            // Brown mushrooms: score penalty of 15, but never below 0
-            int current = player_.getScore();
-            if (current > 0) {
-                int newScore = std::max(0, current - 15);
-                player_.setScore(newScore);
+void PlayingState::processEvents() {
+    const int livesBefore = lives_;
+    bool collected = false;
+    bool enemyHit = false;
+    bool hurt = false;
+
+    for (const GameEvent& event : events_) {
+        switch (event.type) {
+        case GameEventType::Collected: {
+            pendingEvents_ |= TelemetryEvents::Collect;
+            collected = true;
+            comboCount_++;
+            startEffect(Effect::Combo, kComboWindow);
+            int basePoints = getCollectiblePoints(event.item);
+            float comboMultiplier = 1.0f + static_cast<float>(comboCount_) * 0.1f;
+            if (doublePointsActive_) comboMultiplier *= 2.0f;
+            int gained = static_cast<int>(std::round(basePoints * comboMultiplier));
+            player_.addScore(gained);
+            addScorePopup(event.position, gained);
+            break;
+        }
+        case GameEventType::PowerUpStarted: {
+            pendingEvents_ |= TelemetryEvents::PowerUp;
+            collected = true;
+            const CollectibleTraits& traits = collectibleTraits(event.item);
+            switch (traits.effect) {
+            case PowerUpEffect::Magnet:
+                magnetActive_ = true;
+                startEffect(Effect::Magnet, traits.duration);
+                break;
+            case PowerUpEffect::Shield:
+                shieldActive_ = true;
+                startEffect(Effect::Shield, traits.duration);
+                break;
+            case PowerUpEffect::SpeedBoost:
+                player_.applySpeedBoost(traits.strength, traits.duration);
+                break;
+            case PowerUpEffect::DoublePoints:
+                doublePointsActive_ = true;
+                startEffect(Effect::DoublePoints, traits.duration);
+                break;
+            case PowerUpEffect::None:
+                break;
+            }
+            break;
+        }
+        case GameEventType::EnemyKilled:
+            pendingEvents_ |= TelemetryEvents::EnemyKilled;
+            enemyHit = true;
+            player_.addScore(50);
+            comboCount_++;
+            startEffect(Effect::Combo, kComboWindow);
+            triggerScreenShake(6.0f, 0.2f);
+            addScorePopup(event.position, 50);
+            if (event.shielded && shieldActive_) {
+                shieldActive_ = false;
+                endEffect(Effect::Shield);
+                pendingEvents_ |= TelemetryEvents::ShieldBroken;
             }
-            continue;
+            break;
+        case GameEventType::Penalized:
+            pendingEvents_ |= TelemetryEvents::ScorePenalty;
+            player_.setScore(std::max(0, player_.getScore() - event.amount));
+            break;
         }
+    }
 
-        if (isCactus) {
-            // Cactus: harmful, lose life or die
+    // Hits come last. One rule for every source: the shield absorbs a hit,
+    // otherwise it costs a life, and losing the last one ends the run.
+    for (std::size_t i = 0; i < kDamageSourceCount; ++i) {
+        const DamageSource source = static_cast<DamageSource>(i);
+        for (std::uint16_t hit = 0; hit < events_.damageFrom(source); ++hit) {
+            if (shieldActive_) {
+                shieldActive_ = false;
+                endEffect(Effect::Shield);
+                pendingEvents_ |= TelemetryEvents::ShieldBroken;
+                continue;
+            }
+            pendingEvents_ |= damageTelemetry(source);
             if (lives_ > 1) {
                 lives_--;
-                hud_.updateLives(lives_);
-                ouchSound_.play();
-            } else if (lives_ == 1) {
+                hurt = true;
+            }
+            else {
                 lives_ = 0;
-                hud_.updateLives(lives_);
                 player_.die();
             }
         }
     }
+    events_.clear();
+
+    // Once per tick, however many events asked for it
+    if (lives_ != livesBefore) hud_.updateLives(lives_);
+    auto& mixer = SoundMixer::getInstance();
+    if (collected) mixer.play("collect", SoundCategory::Pickup, 0, 55.0f);
+    if (enemyHit) mixer.play("enemy_hit", SoundCategory::Impact, 1, 48.0f);
+    if (hurt && !player_.isDead()) mixer.play("ouch", SoundCategory::Impact, 2, 55.0f);
 }
 
 void PlayingState::updateCamera() {
@@ -601,209 +706,143 @@ void PlayingState::updateCamera() {
     if (cameraShakeTime_ > 0.0f) {
         cameraShakeTime_ -= 1.0f / 60.0f;
         float intensity = cameraShakeIntensity_ * (cameraShakeTime_ / std::max(0.01f, cameraShakeIntensity_));
-        cameraShakeOffset_.x = randomFloat(rng_, -intensity, intensity);
-        cameraShakeOffset_.y = randomFloat(rng_, -intensity * 0.5f, intensity * 0.5f);
+        float jitter[2];
+        rng_.fill(jitter, 2, -intensity, intensity);
+        cameraShakeOffset_.x = jitter[0];
+        cameraShakeOffset_.y = jitter[1] * 0.5f;
     }
     else {
         cameraShakeOffset_ = sf::Vector2f(0.0f, 0.0f);
     }
 }
 
-void PlayingState::ensureGround() {
+void PlayingState::ensureChunks() {
     float playerX = player_.getPosition().x;
-    std::vector<std::tuple<float, float, float>> cactusRequests;
-    while (groundGenerationX_ < playerX + 2400.0f) {
-        float width = randomFloat(rng_, 420.0f, 800.0f);
-        auto ground = std::make_unique<Platform>(
-            sf::Vector2f(groundGenerationX_, 600.0f),
-            sf::Vector2f(width, 140.0f),
-            PlatformType::Normal);
-        // Save cactus spawn requests for after all platforms are generated
-        auto& rm = ResourceManager::getInstance();
-        if (rm.hasTexture("cactus") && randomFloat(rng_, 0.0f, 1.0f) > 0.6f) {
-            float cactusScale = 0.5f;
-            float cactusHeight = rm.getTexture("cactus").getSize().y * cactusScale;
-            float cactusX = groundGenerationX_ + randomFloat(rng_, 40.0f, width - 40.0f);
-            float cactusY = 600.0f - cactusHeight;
-            cactusRequests.emplace_back(cactusX, cactusY, cactusScale);
-        }
-        // Red mushrooms: safe decoration
-        if (rm.hasTexture("mushroom_red") && randomFloat(rng_, 0.0f, 1.0f) > 0.6f) {
-            Decoration deco;
-            deco.sprite.setTexture(rm.getTexture("mushroom_red"));
-            float mushScale = 0.5f;
-            deco.sprite.setScale(mushScale, mushScale);
-            float mushHeight = rm.getTexture("mushroom_red").getSize().y * mushScale;
-            deco.sprite.setPosition(
-                groundGenerationX_ + randomFloat(rng_, 40.0f, width - 40.0f),
-                600.0f - mushHeight);
-            deco.harmful = false;
-            // Avoid overlap with existing decorations
-            bool overlaps = false;
-            for (const auto& existing : decorations_) {
-                if (existing.sprite.getGlobalBounds().intersects(deco.sprite.getGlobalBounds())) {
-                    overlaps = true;
-                    break;
-                }
-            }
-            if (!overlaps) {
-                decorations_.push_back(deco);
-            }
-        }
-        // Brown mushrooms: dangerous obstacle (score penalty)
-        if (rm.hasTexture("decor_mushroom") && randomFloat(rng_, 0.0f, 1.0f) > 0.5f) {
-            Decoration deco;
-            deco.sprite.setTexture(rm.getTexture("decor_mushroom"));
-            float mushScale = 0.5f;
-            deco.sprite.setScale(mushScale, mushScale);
-            float mushHeight = rm.getTexture("decor_mushroom").getSize().y * mushScale;
-            deco.sprite.setPosition(
-                groundGenerationX_ + randomFloat(rng_, 40.0f, width - 40.0f),
-                600.0f - mushHeight);
-            deco.harmful = true;
-            // Avoid overlap with existing decorations
-            bool overlaps = false;
-            for (const auto& existing : decorations_) {
-                if (existing.sprite.getGlobalBounds().intersects(deco.sprite.getGlobalBounds())) {
-                    overlaps = true;
-                    break;
-                }
-            }
-            if (!overlaps) {
-                decorations_.push_back(deco);
-            }
-        }
+    ChunkDescription description;
+    while (chunks_.empty() || chunks_.back().endX() < playerX + kGenerationLookahead) {
+        // If the worker is behind, try again next frame rather than stall
+        if (!generator_->poll(description)) break;
+        materializeChunk(description);
+    }
+}
+
+void PlayingState::materializeChunk(const ChunkDescription& description) {
+    chunks_.emplace_back();
+    WorldChunk& chunk = chunks_.back();
+    chunk.index = description.index;
 
-        platforms_.push_back(std::move(ground));
-        groundGenerationX_ += width;
+    for (std::size_t i = 0; i < description.groundCount; ++i) {
+        const PlatformSpawn& spawn = description.ground[i];
+        chunk.ground.append(spawn.position.x, spawn.position.x + spawn.size.x, spawn.position.y);
     }
-    // After all ground and platforms are generated, place cacti only if not under a platform
-    auto& rm = ResourceManager::getInstance();
-    for (const auto& [cactusX, cactusY, cactusScale] : cactusRequests) {
-        Decoration deco;
-        deco.sprite.setTexture(rm.getTexture("cactus"));
-        deco.sprite.setScale(cactusScale, cactusScale);
-        deco.sprite.setPosition(cactusX, cactusY);
-        deco.harmful = true;
-        sf::FloatRect cactusBounds = deco.sprite.getGlobalBounds();
-        bool underPlatform = false;
-        for (const auto& plat : platforms_) {
-            sf::FloatRect platBounds = plat->getBounds();
-            // If platform is above cactus and horizontally overlaps
-            if (platBounds.left < cactusX + cactusBounds.width &&
-                platBounds.left + platBounds.width > cactusX &&
-                platBounds.top + platBounds.height < 600.0f && // platform is above ground
-                platBounds.top + platBounds.height > cactusY) {
-                underPlatform = true;
-                break;
-            }
-        }
-        if (!underPlatform) {
-            decorations_.push_back(deco);
-        }
+    chunk.platforms.reserve(description.platformCount);
+    for (std::size_t i = 0; i < description.platformCount; ++i) {
+        const PlatformSpawn& spawn = description.platforms[i];
+        chunk.platforms.emplace_back(spawn.position, spawn.size, spawn.type, spawn.movementRange, spawn.movementSpeed, spawn.phase);
     }
+    chunk.collectibles.reserve(description.collectibleCount);
+    // Collectibles and decorations are built later, as they come into view
+    spawnQueue_.push(description);
 }
 
-void PlayingState::ensurePlatforms() {
-    float playerX = player_.getPosition().x;
-    while (generationX_ < playerX + 1200.0f) {
-        float gap = randomFloat(rng_, platformMinGap_, platformMaxGap_);
-        generationX_ += gap;
-        float width = randomFloat(rng_, 160.0f, 360.0f);
-        float height = randomFloat(rng_, 300.0f, 520.0f);
-
-        PlatformType type = PlatformType::Normal;
-        float roll = randomFloat(rng_, 0.0f, 1.0f);
-        if (roll > 0.8f) type = PlatformType::MovingHorizontal;
-        if (roll > 0.9f) type = PlatformType::Bouncy;
-        if (roll > 0.95f) type = PlatformType::Ice;
-
-        float movementRange = (type == PlatformType::MovingHorizontal || type == PlatformType::MovingVertical)
-            ? randomFloat(rng_, 60.0f, 140.0f)
-            : 0.0f;
-        float movementSpeed = (movementRange > 0.0f) ? randomFloat(rng_, 50.0f, 90.0f) : 0.0f;
-
-        auto platform = std::make_unique<Platform>(
-            sf::Vector2f(generationX_, height),
-            sf::Vector2f(width, 32.0f),
-            type,
-            movementRange,
-            movementSpeed);
-
-        spawnCollectiblePattern(*platform);
-
-        // Add a visible spring on bouncy platforms so jumps feel more readable
-        auto& rm = ResourceManager::getInstance();
-        if (type == PlatformType::Bouncy && rm.hasTexture("spring")) {
-            Decoration springDeco;
-            springDeco.sprite.setTexture(rm.getTexture("spring"));
-            float scale = 0.7f;
-            springDeco.sprite.setScale(scale, scale);
-            sf::Vector2f pos(
-                generationX_ + width * 0.5f - (rm.getTexture("spring").getSize().x * scale / 2.0f),
-                height - rm.getTexture("spring").getSize().y * scale);
-            springDeco.sprite.setPosition(pos);
-            springDeco.harmful = false;
-            decorations_.push_back(springDeco);
-        }
-
-        // No extra platform walkers; enemy count is controlled by spawnEnemy()
-
-        platforms_.push_back(std::move(platform));
-        generationX_ += width;
+void PlayingState::materializeSpawns() {
+    spawnQueue_.materialize(cameraX_ + kViewWidth + kMaterializeAhead, [&](const SpawnRecord& record) {
+        if (record.kind == SpawnRecord::Kind::Collectible) {
+            chunkAt(record.position.x).collectibles.add(record.position, static_cast<CollectibleType>(record.type));
+            return;
+        }
+        decorations_.add(static_cast<DecorationKind>(record.type), record.position, record.scale);
+    });
+}
+
+bool PlayingState::holdContact(sf::FloatRect& playerBounds) {
+    if (!contact_.active || !player_.isGrounded() || chunks_.empty()) return false;
+
+    int offset = contact_.chunkIndex - chunks_.front().index;
+    if (offset < 0 || offset >= static_cast<int>(chunks_.size())) return false;
+    Platform& platform = chunks_[static_cast<std::size_t>(offset)].platforms[contact_.platformIndex];
+    if (!platform.isActive()) return false;
+
+    // Carry the player by however far the platform moved since last tick
+    sf::Vector2f carry = platform.getPosition() - contact_.platformPosition;
+    contact_.platformPosition = platform.getPosition();
+
+    sf::FloatRect platformBounds = platform.getBounds();
+    float left = playerBounds.left + carry.x;
+    if (left >= platformBounds.left + platformBounds.width || left + playerBounds.width <= platformBounds.left) {
+        return false;
     }
+
+    sf::Vector2f position = player_.getPosition();
+    player_.setPosition({ position.x + carry.x, position.y + platformBounds.top - (playerBounds.top + playerBounds.height) });
+    playerBounds = player_.getBounds();
+    platform.applyTypeEffect(player_);
+    return true;
+}
+
+WorldChunk& PlayingState::chunkAt(float x) {
+    // Chunks are contiguous by index, so the lookup is a subtraction
+    int offset = static_cast<int>(std::floor(x / WorldChunk::kWidth)) - chunks_.front().index;
+    offset = std::clamp(offset, 0, static_cast<int>(chunks_.size()) - 1);
+    return chunks_[static_cast<std::size_t>(offset)];
 }
 
 void PlayingState::cleanupOldEntities() {
-    float cutoff = player_.getPosition().x - 900.0f;
-    platforms_.erase(std::remove_if(platforms_.begin(), platforms_.end(),
-        [&](const std::unique_ptr<Platform>& platform) {
-            return (!platform->isActive() ||
-                platform->getPosition().x + platform->getSize().x < cutoff);
-        }),
-        platforms_.end());
-
-    projectiles_.erase(std::remove_if(projectiles_.begin(), projectiles_.end(),
-        [&](const Projectile& projectile) {
-            return !projectile.active;
-        }),
-        projectiles_.end());
+    float cutoff = player_.getPosition().x - kCleanupDistance;
+    // Retire whole chunks only, once nothing in them can still reach the cutoff.
+    // Spawn records the oldest snapshot has not built yet stay for a rewind.
+    const WorldSnapshot* oldest = snapshots_.oldest();
+    const std::uint64_t keepFrom = oldest ? oldest->spawnCursor : spawnQueue_.getCursor();
+    while (chunks_.size() > 1 && chunks_.front().endX() + kMaxChunkOverhang < cutoff) {
+        spawnQueue_.retireBefore(chunks_.front().endX(), keepFrom);
+        chunks_.pop_front();
+    }
+    decorations_.trimBefore(cutoff);
+
+    entities_.compact();
 }
 
-void PlayingState::updatePowerUps(float deltaTime) {
-    if (magnetActive_) {
-        magnetTimer_ -= deltaTime;
-        if (magnetTimer_ <= 0.0f) {
+void PlayingState::updateEffects() {
+    effects_.advance(worldTime_, [&](std::size_t id) {
+        switch (static_cast<Effect>(id)) {
+        case Effect::Magnet:
             magnetActive_ = false;
-        }
-    }
-    if (shieldActive_) {
-        shieldTimer_ -= deltaTime;
-        if (shieldTimer_ <= 0.0f) {
+            break;
+        case Effect::Shield:
             shieldActive_ = false;
-        }
-    }
-    if (doublePointsActive_) {
-        doublePointsTimer_ -= deltaTime;
-        if (doublePointsTimer_ <= 0.0f) {
+            break;
+        case Effect::DoublePoints:
             doublePointsActive_ = false;
+            break;
+        case Effect::Combo:
+            comboCount_ = 0;
+            break;
         }
-    }
+    });
 }
 
 void PlayingState::updateDifficulty() {
-    float difficulty = 1.0f + player_.getScore() / 800.0f + distance_ / 800.0f;
-    player_.setRunSpeed(playerBaseSpeed_ + difficulty * 32.0f);
-    platformMinGap_ = std::max(80.0f, 140.0f - difficulty * 6.0f);
-    platformMaxGap_ = std::max(140.0f, 280.0f - difficulty * 10.0f);
+    difficulty_ = 1.0f + player_.getScore() / 800.0f + distance_ / 800.0f;
+    player_.setRunSpeed(playerBaseSpeed_ + difficulty_ * 32.0f);
 }
 
-void PlayingState::handleProjectiles(float deltaTime) {
-    for (auto& projectile : projectiles_) {
-        if (!projectile.active) continue;
-        projectile.shape.move(projectile.velocity * deltaTime);
-        if (projectile.shape.getPosition().x < cameraX_ - 200.0f) {
-            projectile.active = false;
+void PlayingState::updateEntities(float deltaTime) {
+    entities_.integrate(deltaTime);
+    entities_.age(deltaTime);
+
+    for (std::size_t i = 0; i < entities_.size(); ++i) {
+        if (entities_.is(i, Behavior::Projectile)) {
+            if (entities_.getPosition(i).x < cameraX_ - 200.0f) {
+                entities_.destroy(i);
+            }
+        }
+        else if (entities_.is(i, Behavior::Cloud)) {
+            // Clouds drift slowly across the sky and wrap back in ahead of the camera
+            if (entities_.getPosition(i).x < cameraX_ - 300.0f) {
+                float newX = cameraX_ + 1500.0f;
+                float newY = rng_.uniform(60.0f, 220.0f);
+                entities_.setPosition(i, sf::Vector2f(newX, newY));
+            }
         }
     }
 }
@@ -813,46 +852,232 @@ void PlayingState::triggerScreenShake(float intensity, float duration) {
     cameraShakeTime_ = duration;
 }
 
-void PlayingState::updateScorePopups(float deltaTime) {
-    for (auto& popup : scorePopups_) {
-        popup.lifetime -= deltaTime;
-        popup.text.move(popup.velocity * deltaTime);
-        sf::Color color = popup.text.getFillColor();
-        color.a = static_cast<sf::Uint8>(std::max(0.0f, popup.lifetime) / 1.0f * 255);
-        popup.text.setFillColor(color);
-    }
-    scorePopups_.erase(std::remove_if(scorePopups_.begin(), scorePopups_.end(),
-        [](const ScorePopup& popup) { return popup.lifetime <= 0.0f; }),
-        scorePopups_.end());
-}
-
 void PlayingState::addScorePopup(const sf::Vector2f& position, int points) {
     if (!font_) return;
-    ScorePopup popup;
-    popup.text.setFont(*font_);
-    popup.text.setCharacterSize(24);
-    popup.text.setFillColor(sf::Color(255, 255, 255));
-    popup.text.setOutlineColor(sf::Color::Black);
-    popup.text.setOutlineThickness(2.0f);
-    popup.text.setString("+" + std::to_string(points));
-    popup.text.setPosition(position);
-    popup.velocity = sf::Vector2f(0.0f, -30.0f);
-    popup.lifetime = 1.0f;
-    scorePopups_.push_back(popup);
+    SpriteRef label;
+    label.kind = DrawKind::Label;
+    label.layer = RenderLayer::Overlay;
+    label.label = points;
+    std::size_t popup = entities_.create(Behavior::ScorePopup, position);
+    entities_.setSprite(popup, label);
+    entities_.setVelocity(popup, sf::Vector2f(0.0f, -30.0f));
+    entities_.setLifetime(popup, 1.0f, 1.0f);
+}
+
+void PlayingState::recordTelemetry(float deltaTime) {
+    if (!telemetry_) return;
+
+    TelemetrySample sample;
+    sample.tick = tick_++;
+    sample.x = player_.getPosition().x;
+    sample.y = player_.getPosition().y;
+    sample.vx = player_.getVelocity().x;
+    sample.vy = player_.getVelocity().y;
+    sample.state = static_cast<std::uint8_t>(player_.getState());
+    sample.score = player_.getScore();
+    sample.lives = static_cast<std::uint8_t>(std::max(0, lives_));
+    if (magnetActive_) sample.powerUps |= TelemetryPowerUps::Magnet;
+    if (shieldActive_) sample.powerUps |= TelemetryPowerUps::Shield;
+    if (doublePointsActive_) sample.powerUps |= TelemetryPowerUps::DoublePoints;
+    if (player_.hasSpeedBoost()) sample.powerUps |= TelemetryPowerUps::SpeedBoost;
+    if (player_.isDead()) pendingEvents_ |= TelemetryEvents::Death;
+    sample.events = pendingEvents_;
+    sample.frameTime = deltaTime;
+    sample.difficulty = difficulty_;
+
+    telemetry_->record(sample);
+    pendingEvents_ = 0;
+}
+
+void PlayingState::spawnProjectile(const sf::Vector2f& position, const sf::Vector2f& velocity) {
+    SpriteRef shape;
+    shape.kind = DrawKind::Circle;
+    shape.scale = 10.0f;
+    shape.color = sf::Color(255, 140, 140);
+    std::size_t projectile = entities_.create(Behavior::Projectile, position);
+    entities_.setSprite(projectile, shape);
+    entities_.setVelocity(projectile, velocity);
+    entities_.setAabb(projectile, sf::Vector2f(-10.0f, -10.0f), sf::Vector2f(20.0f, 20.0f));
 }
 
-int PlayingState::loadHighScore() const {
-    std::ifstream file("highscore.dat");
-    int score = 0;
-    if (file.is_open()) {
-        file >> score;
+void PlayingState::captureSnapshot() {
+    WorldSnapshot& snapshot = snapshots_.beginWrite();
+
+    snapshot.player = player_.getSnapshot();
+    snapshot.chunkCount = 0;
+    snapshot.groundRunCount = 0;
+    snapshot.platformCount = 0;
+    snapshot.enemyCount = 0;
+    snapshot.collectibleCount = 0;
+    snapshot.projectileCount = 0;
+    snapshot.decorationCount = 0;
+
+    auto capturePlatform = [](const Platform& platform) { return platform.getSnapshot(); };
+    bool complete = true;
+    for (const auto& chunk : chunks_) {
+        if (snapshot.chunkCount == snapshot.chunks.size()) {
+            complete = false;
+            break;
+        }
+        ChunkSnapshot& table = snapshot.chunks[snapshot.chunkCount++];
+        table.index = chunk.index;
+
+        std::size_t before = snapshot.groundRunCount;
+        complete &= captureInto(chunk.ground.getRuns(), snapshot.groundRuns, snapshot.groundRunCount,
+            [](const GroundRun& run) { return run; });
+        table.groundRunCount = snapshot.groundRunCount - before;
+        before = snapshot.platformCount;
+        complete &= captureInto(chunk.platforms, snapshot.platforms, snapshot.platformCount, capturePlatform);
+        table.platformCount = snapshot.platformCount - before;
+
+        before = snapshot.collectibleCount;
+        for (std::size_t i = 0; i < chunk.collectibles.size(); ++i) {
+            if (snapshot.collectibleCount == snapshot.collectibles.size()) {
+                complete = false;
+                break;
+            }
+            snapshot.collectibles[snapshot.collectibleCount++] = chunk.collectibles.getSnapshot(i);
+        }
+        table.collectibleCount = snapshot.collectibleCount - before;
+    }
+    for (std::size_t i = 0; i < decorations_.size(); ++i) {
+        if (snapshot.decorationCount == snapshot.decorations.size()) {
+            complete = false;
+            break;
+        }
+        DecorationSnapshot& captured = snapshot.decorations[snapshot.decorationCount++];
+        captured.kind = decorations_.getKind(i);
+        captured.position = decorations_.getPosition(i);
+        captured.scale = decorations_.getScale(i);
+    }
+    snapshot.enemyCount = enemies_.capture(snapshot.enemies.data(), snapshot.enemies.size());
+    complete &= snapshot.enemyCount == enemies_.size();
+    for (std::size_t i = 0; i < entities_.size(); ++i) {
+        if (!entities_.is(i, Behavior::Projectile)) continue;
+        if (snapshot.projectileCount == snapshot.projectiles.size()) {
+            complete = false;
+            break;
+        }
+        ProjectileSnapshot& captured = snapshot.projectiles[snapshot.projectileCount++];
+        captured.position = entities_.getPosition(i);
+        captured.velocity = entities_.getVelocity(i);
+    }
+    snapshot.truncated = !complete;
+
+    snapshot.lives = lives_;
+    snapshot.cameraX = cameraX_;
+    snapshot.cameraSmoothX = cameraSmoothX_;
+    snapshot.cameraShakeTime = cameraShakeTime_;
+    snapshot.cameraShakeIntensity = cameraShakeIntensity_;
+    snapshot.comboCount = comboCount_;
+    for (std::size_t id = 0; id < snapshot.effectTimes.size(); ++id) {
+        snapshot.effectTimes[id] = effects_.remaining(id);
     }
-    return score;
+    snapshot.distance = distance_;
+    snapshot.spawnTimeline = spawnScheduler_.getState();
+    snapshot.magnetActive = magnetActive_;
+    snapshot.shieldActive = shieldActive_;
+    snapshot.doublePointsActive = doublePointsActive_;
+    snapshot.worldTime = worldTime_;
+    snapshot.spawnCursor = spawnQueue_.getCursor();
+    snapshot.difficulty = difficulty_;
+    snapshot.rng = rng_;
+
+    snapshots_.commit();
 }
 
-void PlayingState::saveHighScore() const {
-    std::ofstream file("highscore.dat", std::ios::trunc);
-    if (file.is_open()) {
-        file << highScore_;
+bool PlayingState::rewind(float seconds) {
+    const std::size_t steps = static_cast<std::size_t>(seconds / kSnapshotInterval);
+    const WorldSnapshot* snapshot = snapshots_.rewind(steps);
+    // A truncated snapshot would restore a partial world, with platforms or
+    // ground missing; step back to the newest complete one instead
+    while (snapshot && snapshot->truncated) {
+        if (snapshots_.size() <= 1) {
+            snapshots_.clear();
+            return false;
+        }
+        snapshot = snapshots_.rewind(1);
+    }
+    if (!snapshot) return false;
+
+    player_.restoreSnapshot(snapshot->player);
+    contact_ = PlatformContact();
+
+    // The generator has moved on since the snapshot; chunks it already
+    // delivered are kept so the level stays contiguous
+    std::deque<WorldChunk> aheadChunks;
+    int restoredLastIndex = snapshot->chunkCount > 0 ? snapshot->chunks[snapshot->chunkCount - 1].index : -1;
+    while (!chunks_.empty() && chunks_.back().index > restoredLastIndex) {
+        aheadChunks.push_front(std::move(chunks_.back()));
+        chunks_.pop_back();
+    }
+    chunks_.clear();
+    std::size_t groundRunIndex = 0;
+    std::size_t platformIndex = 0;
+    std::size_t collectibleIndex = 0;
+    for (std::size_t c = 0; c < snapshot->chunkCount; ++c) {
+        const ChunkSnapshot& table = snapshot->chunks[c];
+        chunks_.emplace_back();
+        WorldChunk& chunk = chunks_.back();
+        chunk.index = table.index;
+        for (std::size_t i = 0; i < table.groundRunCount; ++i) {
+            const GroundRun& run = snapshot->groundRuns[groundRunIndex++];
+            chunk.ground.append(run.startX, run.endX, run.top);
+        }
+        for (std::size_t i = 0; i < table.platformCount; ++i) {
+            chunk.platforms.emplace_back(snapshot->platforms[platformIndex++]);
+        }
+        for (std::size_t i = 0; i < table.collectibleCount; ++i) {
+            chunk.collectibles.add(snapshot->collectibles[collectibleIndex++]);
+        }
     }
+    decorations_.clear();
+    for (std::size_t i = 0; i < snapshot->decorationCount; ++i) {
+        const DecorationSnapshot& captured = snapshot->decorations[i];
+        decorations_.add(captured.kind, captured.position, captured.scale);
+    }
+    // Everything built from spawn records since the snapshot is rebuilt as
+    // the view reaches it again
+    for (auto& chunk : aheadChunks) {
+        chunk.collectibles.clear();
+        chunks_.push_back(std::move(chunk));
+    }
+    if (!spawnQueue_.rewindTo(snapshot->spawnCursor)) {
+        // Never replay records the snapshot had already built; those are
+        // the ones its materialization line had passed
+        spawnQueue_.skipThrough(snapshot->cameraX + kViewWidth + kMaterializeAhead);
+    }
+    enemies_.clear();
+    for (std::size_t i = 0; i < snapshot->enemyCount; ++i) {
+        enemies_.add(snapshot->enemies[i]);
+    }
+    entities_.destroyAll(Behavior::Projectile);
+    entities_.destroyAll(Behavior::ScorePopup);
+    entities_.compact();
+    for (std::size_t i = 0; i < snapshot->projectileCount; ++i) {
+        const ProjectileSnapshot& captured = snapshot->projectiles[i];
+        spawnProjectile(captured.position, captured.velocity);
+    }
+
+    lives_ = snapshot->lives;
+    cameraX_ = snapshot->cameraX;
+    cameraSmoothX_ = snapshot->cameraSmoothX;
+    cameraShakeTime_ = snapshot->cameraShakeTime;
+    cameraShakeIntensity_ = snapshot->cameraShakeIntensity;
+    comboCount_ = snapshot->comboCount;
+    distance_ = snapshot->distance;
+    spawnScheduler_.setState(snapshot->spawnTimeline);
+    magnetActive_ = snapshot->magnetActive;
+    shieldActive_ = snapshot->shieldActive;
+    doublePointsActive_ = snapshot->doublePointsActive;
+    worldTime_ = snapshot->worldTime;
+    effects_.restore(worldTime_, snapshot->effectTimes);
+    difficulty_ = snapshot->difficulty;
+    rng_ = snapshot->rng;
+
+    snapshotTimer_ = 0.0f;
+    pendingEvents_ |= TelemetryEvents::Rewind;
+    hud_.setScore(player_.getScore());
+    hud_.updateLives(lives_);
+    return true;
 }
@@ -7,11 +7,25 @@
 #include "Platform.h"
 #include "Background.h"
 #include "HUD.h"
+#include "WorldChunk.h"
+#include "DecorationStore.h"
+#include "WorldGenerator.h"
+#include "EntityRegistry.h"
+#include "AabbBatch.h"
+#include "SimulationLod.h"
+#include "SpawnQueue.h"
+#include "SpawnScheduler.h"
+#include "TimerWheel.h"
+#include "GameEvents.h"
+#include "TelemetryRecorder.h"
+#include "SnapshotRing.h"
+#include "Random.h"
+#include <array>
 #include <vector>
 #include <memory>
-#include <random>
 #include <deque>
 #include <string>
+#include <cstdint>
 
 class PlayingState : public GameState {
 public:
@@ -23,51 +37,137 @@ public:
     void render(sf::RenderWindow& window) override;
 
 private:
-    struct ScorePopup {
-        sf::Text text;
+    struct ProjectileSnapshot {
+        sf::Vector2f position;
         sf::Vector2f velocity;
-        float lifetime;
     };
 
-    struct Projectile {
-        sf::CircleShape shape;
-        sf::Vector2f velocity;
-        bool active;
+    struct DecorationSnapshot {
+        DecorationKind kind = DecorationKind::Cactus;
+        sf::Vector2f position;
+        float scale = 1.0f;
+    };
+
+    // Everything the simulation needs to resume from a point in time.
+    // Fixed-capacity arrays keep capture allocation-free; clouds and score
+    // popups are cosmetic and not captured.
+    struct ChunkSnapshot {
+        int index = 0;
+        std::size_t groundRunCount = 0;
+        std::size_t platformCount = 0;
+        std::size_t collectibleCount = 0;
+    };
+
+    struct WorldSnapshot {
+        static constexpr std::size_t kMaxChunks = 8;
+        // Room for the most ground and platforms kMaxChunks chunks can hold
+        static constexpr std::size_t kMaxGroundRuns = kMaxChunks * ChunkDescription::kMaxGround;
+        static constexpr std::size_t kMaxPlatforms = kMaxChunks * ChunkDescription::kMaxPlatforms;
+        static constexpr std::size_t kMaxEnemies = 16;
+        static constexpr std::size_t kMaxCollectibles = 256;
+        static constexpr std::size_t kMaxProjectiles = 32;
+        static constexpr std::size_t kMaxDecorations = 128;
+
+        PlayerSnapshot player;
+        // Chunk contents are stored back to back, in chunk order; decorations
+        // are not chunk content and are stored in x order
+        std::array<ChunkSnapshot, kMaxChunks> chunks;
+        std::array<GroundRun, kMaxGroundRuns> groundRuns;
+        std::array<PlatformSnapshot, kMaxPlatforms> platforms;
+        std::array<EnemySnapshot, kMaxEnemies> enemies;
+        std::array<CollectibleSnapshot, kMaxCollectibles> collectibles;
+        std::array<ProjectileSnapshot, kMaxProjectiles> projectiles;
+        std::array<DecorationSnapshot, kMaxDecorations> decorations;
+        std::size_t chunkCount = 0;
+        std::size_t groundRunCount = 0;
+        std::size_t platformCount = 0;
+        std::size_t enemyCount = 0;
+        std::size_t collectibleCount = 0;
+        std::size_t projectileCount = 0;
+        std::size_t decorationCount = 0;
+        bool truncated = false;  // something did not fit; rewind skips these
+
+        int lives = 0;
+        float cameraX = 0.0f;
+        float cameraSmoothX = 0.0f;
+        float cameraShakeTime = 0.0f;
+        float cameraShakeIntensity = 0.0f;
+        int comboCount = 0;
+        std::array<float, TimerWheel::kMaxTimers> effectTimes{};  // seconds left per Effect
+        float distance = 0.0f;
+        SpawnScheduler::State spawnTimeline;
+        bool magnetActive = false;
+        bool shieldActive = false;
+        bool doublePointsActive = false;
+        float worldTime = 0.0f;
+        float difficulty = 0.0f;
+        std::uint64_t spawnCursor = 0;
+        CounterRng rng{ 0 };
     };
 
-    struct Decoration {
-        sf::Sprite sprite;
-        bool harmful;
+    // The platform the player stood on at the end of the last tick
+    struct PlatformContact {
+        bool active = false;
+        int chunkIndex = 0;
+        std::size_t platformIndex = 0;
+        sf::Vector2f platformPosition;  // where the platform was at that time
     };
 
-    void spawnEnemy();
-    void spawnCollectiblePattern(const Platform& platform);
-    void checkCollisions(const sf::FloatRect& prevPlayerBounds);
+    // Timed effects, by their id in effects_
+    enum class Effect : std::uint8_t {
+        Magnet,
+        Shield,
+        DoublePoints,
+        Combo  // window for the next pickup or kill to extend the combo
+    };
+
+    void startEffect(Effect effect, float seconds) { effects_.start(static_cast<std::size_t>(effect), seconds); }
+    void endEffect(Effect effect) { effects_.cancel(static_cast<std::size_t>(effect)); }
+
+    void runSpawnRule(const SpawnRule& rule);
+    void spawnEnemy(EnemyType type);
+    void checkCollisions(const sf::FloatRect& prevPlayerBounds, float deltaTime);
+    bool holdContact(sf::FloatRect& playerBounds);
+    // Applies the events checkCollisions queued this tick, in order
+    void processEvents();
     void updateCamera();
-    void ensureGround();
-    void ensurePlatforms();
+    void ensureChunks();
+    void materializeChunk(const ChunkDescription& description);
+    void materializeSpawns();
+    WorldChunk& chunkAt(float x);
     void cleanupOldEntities();
-    void updatePowerUps(float deltaTime);
+    void updateEffects();
     void updateDifficulty();
-    void handleProjectiles(float deltaTime);
+    void updateEntities(float deltaTime);
     void triggerScreenShake(float intensity, float duration);
-    void updateScorePopups(float deltaTime);
     void addScorePopup(const sf::Vector2f& position, int points);
-    int loadHighScore() const;
-    void saveHighScore() const;
+    void recordTelemetry(float deltaTime);
+    void spawnProjectile(const sf::Vector2f& position, const sf::Vector2f& velocity);
+    void captureSnapshot();
+    bool rewind(float seconds);
 
     Player player_;
     Background background_;
     HUD hud_;
 
-    std::vector<std::unique_ptr<Enemy>> enemies_;
-    std::vector<std::unique_ptr<Collectible>> collectibles_;
-    std::vector<std::unique_ptr<Platform>> platforms_;
-    std::vector<Projectile> projectiles_;
-    std::deque<ScorePopup> scorePopups_;
-    std::vector<Decoration> decorations_;
-    std::vector<sf::Sprite> clouds_;
-    std::vector<float> cloudSpeeds_;
+    std::unique_ptr<WorldGenerator> generator_;
+    std::deque<WorldChunk> chunks_;
+    DecorationStore decorations_;
+    PlatformContact contact_;
+    SpawnQueue spawnQueue_;
+    SpawnScheduler spawnScheduler_;
+    TimerWheel effects_;
+    EnemySet enemies_;
+    std::vector<sf::Vector2f> enemyShots_;
+    EntityRegistry entities_;
+    SimulationLod lod_;
+
+    // Broad phase of checkCollisions; kept so its storage is reused each tick
+    AabbBatch broadphase_;
+    HitMask broadphaseHits_;
+    std::vector<std::size_t> projectileSlots_;
+    // What checkCollisions found this tick, for processEvents
+    GameEventQueue events_;
 
     int lives_;
 
@@ -76,26 +176,15 @@ private:
     sf::Vector2f cameraShakeOffset_;
     float cameraShakeTime_;
     float cameraShakeIntensity_;
-    float generationX_;
-    float groundGenerationX_;
-    float comboTimer_;
     int comboCount_;
     float scoreMultiplier_;
-    float doublePointsTimer_;
-    float magnetTimer_;
-    float shieldTimer_;
     float magnetRadius_;
     int highScore_;
     float distance_;
-    float platformMinGap_;
-    float platformMaxGap_;
     float difficultyTimer_;
     float enemySpawnTimer_;
     float projectileSpeed_;
     float playerBaseSpeed_;
-    float lastEnemyBatchDistance_;
-    float lastGoldenCarrotDistance_;
-    float lastCoinDistance_;
 
     bool paused_;
     bool magnetActive_;
@@ -103,14 +192,21 @@ private:
     bool doublePointsActive_;
 
     float worldTime_;
+    float difficulty_;
+
+    std::uint32_t runSeed_;
+    CounterRng rng_;
+
+    SnapshotRing<WorldSnapshot> snapshots_;
+    float snapshotTimer_;
 
-    std::mt19937 rng_;
-    sf::Sound collectSound_;
-    sf::Sound enemyHitSound_;
-    sf::Sound hitSound_;
-    sf::Sound ouchSound_;
+    std::unique_ptr<TelemetryRecorder> telemetry_;
+    std::uint32_t tick_;
+    std::uint16_t pendingEvents_;
 
     sf::RectangleShape pauseOverlay_;
     sf::Text pauseText_;
+    sf::Text lodText_;
+    bool showLodStats_;
     sf::Font* font_;
 };
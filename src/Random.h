@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// SplitMix64 finalizer. Good avalanche, so adjacent inputs give unrelated outputs.
+inline std::uint64_t mix64(std::uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return value;
+}
+
+// Seed for one chunk of one run; independent of every other chunk.
+inline std::uint64_t chunkSeed(std::uint32_t runSeed, int chunkIndex) {
+    return mix64((static_cast<std::uint64_t>(runSeed) << 32) | static_cast<std::uint32_t>(chunkIndex));
+}
+
+// Counter-based stream: the n-th output is mix64(key + n * gamma), so a
+// stream is just a key and a position and can start anywhere. Sixteen bytes
+// of state, trivially copyable, cheap to snapshot or hand to another thread.
+class CounterRng {
+public:
+    explicit CounterRng(std::uint64_t key, std::uint64_t counter = 0)
+        : key_(key)
+        , counter_(counter) {
+    }
+
+    std::uint64_t next() {
+        return mix64(key_ + (++counter_) * kGamma);
+    }
+
+    // Uniform in [0, 1)
+    float unit() {
+        return toUnit(next());
+    }
+
+    // Uniform in [minValue, maxValue)
+    float uniform(float minValue, float maxValue) {
+        return minValue + (maxValue - minValue) * unit();
+    }
+
+    // True with the given probability
+    bool chance(float probability) {
+        return unit() < probability;
+    }
+
+    // Writes the next `count` values of uniform(minValue, maxValue). Each
+    // output depends only on its counter, so the loop has no carried state
+    // and the compiler is free to vectorize it.
+    void fill(float* out, std::size_t count, float minValue, float maxValue) {
+        const float range = maxValue - minValue;
+        const std::uint64_t base = counter_;
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = minValue + range * toUnit(mix64(key_ + (base + i + 1) * kGamma));
+        }
+        counter_ += count;
+    }
+
+    std::uint64_t getCounter() const { return counter_; }
+
+private:
+    static float toUnit(std::uint64_t bits) {
+        // Top 24 bits fill a float mantissa exactly
+        return static_cast<float>(bits >> 40) * (1.0f / 16777216.0f);
+    }
+
+    static constexpr std::uint64_t kGamma = 0x9E3779B97F4A7C15ull;
+
+    std::uint64_t key_;
+    std::uint64_t counter_;
+};
+
+static_assert(std::is_trivially_copyable<CounterRng>::value, "CounterRng must stay trivially copyable");
@@ -7,11 +7,18 @@ ResourceManager& ResourceManager::getInstance() {
 }
 
 bool ResourceManager::loadTexture(const std::string& name, const std::string& path) {
+    sf::Image image;
     auto texture = std::make_unique<sf::Texture>();
-    if (!texture->loadFromFile(path)) {
+    if (!image.loadFromFile(path) || !texture->loadFromImage(image)) {
         std::cerr << "Failed to load texture: " << path << std::endl;
         return false;
     }
+    // Reloading a name replaces the texture, so drop the old one's masks
+    auto previous = textures_.find(name);
+    if (previous != textures_.end()) {
+        forgetMasks(previous->second.get());
+    }
+    masks_[texture.get()] = CollisionMask(image);
     textures_[name] = std::move(texture);
     return true;
 }
@@ -27,6 +34,24 @@ bool ResourceManager::hasTexture(const std::string& name) const {
     return textures_.find(name) != textures_.end();
 }
 
+const CollisionMask* ResourceManager::getCollisionMask(const sf::Texture& texture, float scaleX, float scaleY) {
+    auto key = std::make_tuple(&texture, scaleX, scaleY);
+    auto scaled = scaledMasks_.find(key);
+    if (scaled != scaledMasks_.end()) return &scaled->second;
+
+    auto source = masks_.find(&texture);
+    if (source == masks_.end()) return nullptr;
+    return &scaledMasks_.emplace(key, source->second.scaled(scaleX, scaleY)).first->second;
+}
+
+void ResourceManager::forgetMasks(const sf::Texture* texture) {
+    masks_.erase(texture);
+    for (auto it = scaledMasks_.begin(); it != scaledMasks_.end();) {
+        if (std::get<0>(it->first) == texture) it = scaledMasks_.erase(it);
+        else ++it;
+    }
+}
+
 bool ResourceManager::loadSoundBuffer(const std::string& name, const std::string& path) {
     auto soundBuffer = std::make_unique<sf::SoundBuffer>();
     if (!soundBuffer->loadFromFile(path)) {
@@ -70,6 +95,8 @@ bool ResourceManager::hasFont(const std::string& name) const {
 }
 
 void ResourceManager::clear() {
+    scaledMasks_.clear();
+    masks_.clear();
     textures_.clear();
     soundBuffers_.clear();
     fonts_.clear();
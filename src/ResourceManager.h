@@ -2,9 +2,11 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include "CollisionMask.h"
 #include <map>
 #include <string>
 #include <memory>
+#include <tuple>
 
 class ResourceManager {
 public:
@@ -15,6 +17,10 @@ public:
     sf::Texture& getTexture(const std::string& name);
     bool hasTexture(const std::string& name) const;
 
+    // Opaque pixels of a loaded texture drawn at the given scale, built from
+    // the alpha mask taken at load time. Null if the texture is not ours.
+    const CollisionMask* getCollisionMask(const sf::Texture& texture, float scaleX, float scaleY);
+
     // Sound management
     bool loadSoundBuffer(const std::string& name, const std::string& path);
     sf::SoundBuffer& getSoundBuffer(const std::string& name);
@@ -34,7 +40,11 @@ private:
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
 
+    void forgetMasks(const sf::Texture* texture);
+
     std::map<std::string, std::unique_ptr<sf::Texture>> textures_;
+    std::map<const sf::Texture*, CollisionMask> masks_;
+    std::map<std::tuple<const sf::Texture*, float, float>, CollisionMask> scaledMasks_;
     std::map<std::string, std::unique_ptr<sf::SoundBuffer>> soundBuffers_;
     std::map<std::string, std::unique_ptr<sf::Font>> fonts_;
 };
@@ -0,0 +1,192 @@
+#include "ScoreStore.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    const char* kFileMagic = "BPLB";
+    const int kFileVersion = 1;
+
+    // Pushes the file's contents to the disk so a rename never exposes data
+    // that is still only in the OS cache
+    bool syncToDisk(std::FILE* file) {
+#ifdef _WIN32
+        return _commit(_fileno(file)) == 0;
+#else
+        return fsync(fileno(file)) == 0;
+#endif
+    }
+}
+
+ScoreStore& ScoreStore::getInstance() {
+    static ScoreStore instance;
+    return instance;
+}
+
+ScoreStore::ScoreStore()
+    : path_("highscore.dat")
+    , highScore_(0)
+    , loaded_(false)
+    , requestedGeneration_(0)
+    , writtenGeneration_(0)
+    , stopping_(false) {
+    worker_ = std::thread(&ScoreStore::run, this);
+}
+
+ScoreStore::~ScoreStore() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void ScoreStore::submit(const LeaderboardEntry& entry) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!qualifiesLocked(entry.score)) return;
+        insertSorted(entry);
+        ++requestedGeneration_;
+    }
+    wake_.notify_one();
+}
+
+int ScoreStore::getHighScore() const {
+    return highScore_.load(std::memory_order_relaxed);
+}
+
+bool ScoreStore::qualifies(int score) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return qualifiesLocked(score);
+}
+
+bool ScoreStore::qualifiesLocked(int score) const {
+    if (score <= 0) return false;
+    return entries_.size() < kMaxEntries || score > entries_.back().score;
+}
+
+bool ScoreStore::isLoaded() const {
+    return loaded_.load(std::memory_order_acquire);
+}
+
+void ScoreStore::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_.wait(lock, [this] { return writtenGeneration_ >= requestedGeneration_ || stopping_; });
+}
+
+void ScoreStore::insertSorted(const LeaderboardEntry& entry) {
+    auto it = std::upper_bound(entries_.begin(), entries_.end(), entry,
+        [](const LeaderboardEntry& a, const LeaderboardEntry& b) { return a.score > b.score; });
+    entries_.insert(it, entry);
+    if (entries_.size() > kMaxEntries) {
+        entries_.resize(kMaxEntries);
+    }
+    if (!entries_.empty()) {
+        highScore_.store(entries_.front().score, std::memory_order_relaxed);
+    }
+}
+
+void ScoreStore::run() {
+    // Load once, merging with anything submitted before the read finished
+    std::vector<LeaderboardEntry> stored = readFile();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& entry : stored) {
+            insertSorted(entry);
+        }
+        loaded_.store(true, std::memory_order_release);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this] { return stopping_ || requestedGeneration_ != writtenGeneration_; });
+        if (requestedGeneration_ != writtenGeneration_) {
+            std::uint64_t generation = requestedGeneration_;
+            std::vector<LeaderboardEntry> snapshot = entries_;
+            lock.unlock();
+            writeFile(snapshot);
+            lock.lock();
+            writtenGeneration_ = generation;
+            written_.notify_all();
+        }
+        else if (stopping_) {
+            break;
+        }
+    }
+    written_.notify_all();
+}
+
+std::vector<LeaderboardEntry> ScoreStore::readFile() const {
+    std::vector<LeaderboardEntry> entries;
+    std::ifstream file(path_);
+    if (!file.is_open()) return entries;
+
+    std::string first;
+    if (!(file >> first)) return entries;
+
+    if (first != kFileMagic) {
+        // Legacy highscore.dat: a single integer
+        std::istringstream legacy(first);
+        LeaderboardEntry entry;
+        if (legacy >> entry.score && entry.score > 0) {
+            entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    int version = 0;
+    file >> version;
+    if (version != kFileVersion) {
+        std::cerr << "Unknown leaderboard version in " << path_ << std::endl;
+        return entries;
+    }
+
+    LeaderboardEntry entry;
+    while (file >> entry.score >> entry.distance >> entry.seed >> entry.date) {
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+bool ScoreStore::writeFile(const std::vector<LeaderboardEntry>& entries) const {
+    const std::string tempPath = path_ + ".tmp";
+    std::ostringstream contents;
+    contents << kFileMagic << ' ' << kFileVersion << '\n';
+    for (const auto& entry : entries) {
+        contents << entry.score << ' ' << entry.distance << ' ' << entry.seed << ' ' << entry.date << '\n';
+    }
+    const std::string data = contents.str();
+
+    std::FILE* file = std::fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Failed to write leaderboard: " << tempPath << std::endl;
+        return false;
+    }
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = std::fflush(file) == 0 && ok;
+    ok = syncToDisk(file) && ok;
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        std::cerr << "Failed to write leaderboard: " << tempPath << std::endl;
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path_, error);
+    if (error) {
+        std::cerr << "Failed to replace " << path_ << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct LeaderboardEntry {
+    int score = 0;
+    float distance = 0.0f;
+    std::uint32_t seed = 0;
+    std::int64_t date = 0; // seconds since epoch
+};
+
+// Local top-N leaderboard persisted on a background I/O thread.
+// Reads come from an in-memory cache; writes go to a temp file that is
+// renamed over the real one, so a crash never leaves a half-written file.
+class ScoreStore {
+public:
+    static ScoreStore& getInstance();
+
+    // Never blocks on disk; the write happens on the I/O thread.
+    // Entries that would not make the board are ignored.
+    void submit(const LeaderboardEntry& entry);
+
+    // True if a run with this score would make the board.
+    bool qualifies(int score) const;
+
+    int getHighScore() const;
+    bool isLoaded() const;
+
+    // Blocks until every submitted entry has been written.
+    void flush();
+
+    static constexpr std::size_t kMaxEntries = 10;
+
+private:
+    ScoreStore();
+    ~ScoreStore();
+    ScoreStore(const ScoreStore&) = delete;
+    ScoreStore& operator=(const ScoreStore&) = delete;
+
+    void run();
+    std::vector<LeaderboardEntry> readFile() const;
+    bool writeFile(const std::vector<LeaderboardEntry>& entries) const;
+    void insertSorted(const LeaderboardEntry& entry);
+    bool qualifiesLocked(int score) const;
+
+    std::string path_;
+    std::vector<LeaderboardEntry> entries_;
+    std::atomic<int> highScore_;
+    std::atomic<bool> loaded_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable written_;
+    std::uint64_t requestedGeneration_;
+    std::uint64_t writtenGeneration_;
+    bool stopping_;
+
+    std::thread worker_;
+};
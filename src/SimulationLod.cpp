@@ -0,0 +1,36 @@
+#include "SimulationLod.h"
+
+SimulationLod::SimulationLod()
+    : tiers_{ { { 0.0f, 1 }, { 400.0f, 4 }, { 1600.0f, 0 } } }
+    , viewRight_(0.0f)
+    , tick_(0) {
+}
+
+void SimulationLod::setTiers(const std::array<LodTier, kTierCount>& tiers) {
+    tiers_ = tiers;
+    tiers_[0].interval = 1;
+}
+
+void SimulationLod::beginTick(float viewRight) {
+    viewRight_ = viewRight;
+    ++tick_;
+    counters_ = LodCounters();
+}
+
+bool SimulationLod::shouldUpdate(float x, std::size_t count) {
+    const float distance = x - viewRight_;
+    std::size_t tier = 0;
+    while (tier + 1 < kTierCount && distance >= tiers_[tier + 1].distance) {
+        ++tier;
+    }
+
+    const std::uint32_t interval = tiers_[tier].interval;
+    const bool update = interval != 0 && tick_ % interval == 0;
+    if (update) {
+        counters_.updated += static_cast<std::uint32_t>(count);
+    }
+    else {
+        counters_.skipped += static_cast<std::uint32_t>(count);
+    }
+    return update;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Everything at least `distance` px past the right edge of the view updates
+// every `interval` ticks. An interval of 0 puts it to sleep.
+struct LodTier {
+    float distance = 0.0f;
+    std::uint32_t interval = 1;
+};
+
+struct LodCounters {
+    std::uint32_t updated = 0;
+    std::uint32_t skipped = 0;
+};
+
+// Activity tiers by distance ahead of the view. The first tier covers the
+// view itself and everything behind it and always updates every tick; its
+// distance is ignored. Objects in far tiers must not drift while skipped:
+// their motion has to be a function of world time (see Kinematics.h), so
+// the first update after waking puts them exactly where they belong.
+class SimulationLod {
+public:
+    static constexpr std::size_t kTierCount = 3;
+
+    SimulationLod();
+
+    // Tiers must be sorted by distance
+    void setTiers(const std::array<LodTier, kTierCount>& tiers);
+    const std::array<LodTier, kTierCount>& getTiers() const { return tiers_; }
+
+    // Call once per tick before any shouldUpdate(); resets the counters
+    void beginTick(float viewRight);
+
+    // Whether `count` objects whose leftmost point is at x update this tick.
+    // The outcome is added to the counters.
+    bool shouldUpdate(float x, std::size_t count = 1);
+
+    const LodCounters& getCounters() const { return counters_; }
+
+private:
+    std::array<LodTier, kTierCount> tiers_;
+    float viewRight_;
+    std::uint32_t tick_;
+    LodCounters counters_;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Fixed-size history of T. All slots are allocated up front, so writing a
+// snapshot is a plain copy into existing storage with no heap allocation.
+template <typename T>
+class SnapshotRing {
+public:
+    explicit SnapshotRing(std::size_t capacity)
+        : slots_(capacity)
+        , newest_(0)
+        , count_(0) {
+    }
+
+    // Returns the slot to fill; it becomes visible after commit().
+    T& beginWrite() {
+        return slots_[(newest_ + 1) % slots_.size()];
+    }
+
+    void commit() {
+        newest_ = (newest_ + 1) % slots_.size();
+        if (count_ < slots_.size()) ++count_;
+    }
+
+    // Drops the newest `steps` snapshots and returns the one that is now newest,
+    // or nullptr if the ring is empty.
+    const T* rewind(std::size_t steps) {
+        if (count_ == 0) return nullptr;
+        if (steps >= count_) steps = count_ - 1;
+        newest_ = (newest_ + slots_.size() - steps) % slots_.size();
+        count_ -= steps;
+        return &slots_[newest_];
+    }
+
+    // The oldest snapshot still held, or nullptr if the ring is empty.
+    const T* oldest() const {
+        if (count_ == 0) return nullptr;
+        return &slots_[(newest_ + slots_.size() - (count_ - 1)) % slots_.size()];
+    }
+
+    void clear() { count_ = 0; }
+    std::size_t size() const { return count_; }
+    std::size_t capacity() const { return slots_.size(); }
+
+private:
+    std::vector<T> slots_;
+    std::size_t newest_;
+    std::size_t count_;
+};
@@ -0,0 +1,97 @@
+#include "SoundMixer.h"
+#include "ResourceManager.h"
+#include <algorithm>
+
+SoundMixer& SoundMixer::getInstance() {
+    static SoundMixer instance;
+    return instance;
+}
+
+SoundMixer::SoundMixer()
+    : frameStartCount_(0)
+    , nextSerial_(1) {
+    categoryVolumes_.fill(100.0f);
+    frameStarts_.fill(nullptr);
+}
+
+void SoundMixer::beginFrame() {
+    frameStartCount_ = 0;
+}
+
+bool SoundMixer::play(const std::string& name, SoundCategory category, int priority, float volume) {
+    auto& rm = ResourceManager::getInstance();
+    if (!rm.hasSoundBuffer(name)) return false;
+    const sf::SoundBuffer* buffer = &rm.getSoundBuffer(name);
+
+    // Several pickups in one frame should sound like one, not a louder phase-stacked copy
+    if (startedThisFrame(buffer)) return false;
+
+    Voice* voice = acquireVoice(priority);
+    if (!voice) return false;
+
+    voice->sound.stop();
+    if (voice->buffer != buffer) {
+        voice->sound.setBuffer(*buffer);
+        voice->buffer = buffer;
+    }
+    voice->category = category;
+    voice->priority = priority;
+    voice->baseVolume = volume;
+    voice->serial = nextSerial_++;
+    voice->sound.setVolume(volume * categoryVolumes_[static_cast<std::size_t>(category)] / 100.0f);
+    voice->sound.play();
+
+    if (frameStartCount_ < frameStarts_.size()) {
+        frameStarts_[frameStartCount_++] = buffer;
+    }
+    return true;
+}
+
+SoundMixer::Voice* SoundMixer::acquireVoice(int priority) {
+    Voice* victim = nullptr;
+    for (auto& voice : voices_) {
+        if (voice.sound.getStatus() != sf::Sound::Playing) {
+            return &voice;
+        }
+        if (voice.priority > priority) continue;
+        // Prefer the lowest priority, then the oldest voice
+        if (!victim ||
+            voice.priority < victim->priority ||
+            (voice.priority == victim->priority && voice.serial < victim->serial)) {
+            victim = &voice;
+        }
+    }
+    return victim;
+}
+
+bool SoundMixer::startedThisFrame(const sf::SoundBuffer* buffer) const {
+    for (std::size_t i = 0; i < frameStartCount_; ++i) {
+        if (frameStarts_[i] == buffer) return true;
+    }
+    return false;
+}
+
+void SoundMixer::setCategoryVolume(SoundCategory category, float volume) {
+    const float clamped = std::clamp(volume, 0.0f, 100.0f);
+    categoryVolumes_[static_cast<std::size_t>(category)] = clamped;
+    for (auto& voice : voices_) {
+        if (voice.category == category) {
+            voice.sound.setVolume(voice.baseVolume * clamped / 100.0f);
+        }
+    }
+}
+
+float SoundMixer::getCategoryVolume(SoundCategory category) const {
+    return categoryVolumes_[static_cast<std::size_t>(category)];
+}
+
+void SoundMixer::stopAll() {
+    for (auto& voice : voices_) {
+        voice.sound.stop();
+    }
+}
+
+std::size_t SoundMixer::getActiveVoiceCount() const {
+    return static_cast<std::size_t>(std::count_if(voices_.begin(), voices_.end(),
+        [](const Voice& voice) { return voice.sound.getStatus() == sf::Sound::Playing; }));
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class SoundCategory {
+    Player,   // jump, slide, death
+    Pickup,   // carrots, coins, power-ups
+    Impact,   // damage and enemy hits
+    Count
+};
+
+// Fixed pool of sf::Sound voices shared by every game state.
+// Sounds started while all voices are busy steal the oldest voice of
+// equal or lower priority; the same buffer is only started once per frame.
+class SoundMixer {
+public:
+    static SoundMixer& getInstance();
+
+    // Call once per frame before any state plays sounds.
+    void beginFrame();
+
+    // Returns false if the sound was dropped (missing buffer, duplicate this
+    // frame, or every voice is busy with a higher priority sound).
+    bool play(const std::string& name, SoundCategory category, int priority = 0, float volume = 100.0f);
+
+    void setCategoryVolume(SoundCategory category, float volume);
+    float getCategoryVolume(SoundCategory category) const;
+
+    void stopAll();
+    std::size_t getActiveVoiceCount() const;
+
+    static constexpr std::size_t kVoiceCount = 12;
+
+private:
+    SoundMixer();
+    ~SoundMixer() = default;
+    SoundMixer(const SoundMixer&) = delete;
+    SoundMixer& operator=(const SoundMixer&) = delete;
+
+    struct Voice {
+        sf::Sound sound;
+        const sf::SoundBuffer* buffer = nullptr;
+        SoundCategory category = SoundCategory::Player;
+        int priority = 0;
+        float baseVolume = 100.0f;
+        std::uint64_t serial = 0;
+    };
+
+    Voice* acquireVoice(int priority);
+    bool startedThisFrame(const sf::SoundBuffer* buffer) const;
+
+    std::array<Voice, kVoiceCount> voices_;
+    std::array<float, static_cast<std::size_t>(SoundCategory::Count)> categoryVolumes_;
+    std::array<const sf::SoundBuffer*, kVoiceCount> frameStarts_;
+    std::size_t frameStartCount_;
+    std::uint64_t nextSerial_;
+};
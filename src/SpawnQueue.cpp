@@ -0,0 +1,73 @@
+#include "SpawnQueue.h"
+#include <algorithm>
+
+namespace {
+    bool leftOf(const SpawnRecord& a, const SpawnRecord& b) {
+        return a.position.x < b.position.x;
+    }
+}
+
+SpawnQueue::SpawnQueue()
+    : firstSequence_(0)
+    , cursor_(0) {
+}
+
+void SpawnQueue::push(const ChunkDescription& chunk) {
+    batch_.clear();
+    for (std::size_t i = 0; i < chunk.collectibleCount; ++i) {
+        const CollectibleSpawn& spawn = chunk.collectibles[i];
+        SpawnRecord record;
+        record.position = spawn.position;
+        record.kind = SpawnRecord::Kind::Collectible;
+        record.type = static_cast<std::uint8_t>(spawn.type);
+        record.pattern = spawn.pattern;
+        batch_.push_back(record);
+    }
+    for (std::size_t i = 0; i < chunk.decorationCount; ++i) {
+        const DecorationSpawn& spawn = chunk.decorations[i];
+        SpawnRecord record;
+        record.position = spawn.position;
+        record.scale = spawn.scale;
+        record.kind = SpawnRecord::Kind::Decoration;
+        record.type = static_cast<std::uint8_t>(spawn.kind);
+        batch_.push_back(record);
+    }
+    std::stable_sort(batch_.begin(), batch_.end(), leftOf);
+
+    // Chunks arrive left to right, so this is almost always a plain append
+    for (const SpawnRecord& record : batch_) {
+        auto pendingBegin = records_.begin() + static_cast<std::ptrdiff_t>(cursor_);
+        if (records_.empty() || !leftOf(record, records_.back())) {
+            records_.push_back(record);
+        }
+        else {
+            records_.insert(std::upper_bound(pendingBegin, records_.end(), record, leftOf), record);
+        }
+    }
+}
+
+void SpawnQueue::retireBefore(float x, std::uint64_t keepFrom) {
+    while (cursor_ > 0 && firstSequence_ < keepFrom && records_.front().position.x < x) {
+        records_.pop_front();
+        ++firstSequence_;
+        --cursor_;
+    }
+}
+
+bool SpawnQueue::rewindTo(std::uint64_t cursor) {
+    if (cursor < firstSequence_) return false;
+    cursor_ = std::min(static_cast<std::size_t>(cursor - firstSequence_), records_.size());
+    return true;
+}
+
+void SpawnQueue::skipThrough(float lineX) {
+    SpawnRecord line;
+    line.position.x = lineX;
+    cursor_ = static_cast<std::size_t>(std::upper_bound(records_.begin(), records_.end(), line, leftOf) - records_.begin());
+}
+
+void SpawnQueue::clear() {
+    records_.clear();
+    firstSequence_ = 0;
+    cursor_ = 0;
+}
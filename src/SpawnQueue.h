@@ -0,0 +1,65 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include "WorldGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+// A generated collectible or decoration that has not been built yet
+struct SpawnRecord {
+    enum class Kind : std::uint8_t {
+        Collectible,
+        Decoration
+    };
+
+    sf::Vector2f position;
+    float scale = 1.0f;  // decorations only
+    Kind kind = Kind::Collectible;
+    std::uint8_t type = 0;  // CollectibleType or DecorationKind
+    CollectiblePattern pattern = CollectiblePattern::Line;
+};
+
+// Spawn records from delivered chunks, sorted by x. Generation only pushes
+// records; real entities are built when the materialization line passes a
+// record, so content the player never reaches is never built.
+//
+// Materialized records are kept until their chunk retires and no rewind
+// snapshot can still need them, so a rewind can move the cursor back and
+// replay them. Cursors are sequence numbers that
+// stay valid while records are retired from the front.
+class SpawnQueue {
+public:
+    SpawnQueue();
+
+    void push(const ChunkDescription& chunk);
+
+    // Calls fn(record) for every pending record with x <= lineX, in x order
+    template <typename Fn>
+    void materialize(float lineX, Fn fn) {
+        while (cursor_ < records_.size() && records_[cursor_].position.x <= lineX) {
+            fn(records_[cursor_++]);
+        }
+    }
+
+    // Drops materialized records left of x, but none at or after sequence
+    // keepFrom, so a cursor that old can still be rewound to
+    void retireBefore(float x, std::uint64_t keepFrom);
+
+    std::uint64_t getCursor() const { return firstSequence_ + cursor_; }
+    // Returns false, leaving the cursor alone, if records the cursor points
+    // at were already retired
+    bool rewindTo(std::uint64_t cursor);
+    // Moves the cursor past every record with x <= lineX
+    void skipThrough(float lineX);
+
+    std::size_t pendingCount() const { return records_.size() - cursor_; }
+    void clear();
+
+private:
+    std::deque<SpawnRecord> records_;
+    std::vector<SpawnRecord> batch_;  // reused while sorting one chunk
+    std::uint64_t firstSequence_;     // sequence number of records_.front()
+    std::size_t cursor_;              // index of the next pending record
+};
@@ -0,0 +1,46 @@
+#include "SpawnScheduler.h"
+#include <algorithm>
+
+namespace {
+    // std heaps are max-heaps; ordering by "later" puts the earliest on top
+    bool later(const SpawnEvent& a, const SpawnEvent& b) {
+        return a.due > b.due;
+    }
+}
+
+SpawnScheduler::SpawnScheduler(const SpawnRule* rules, std::size_t count)
+    : rules_(rules)
+    , ruleCount_(std::min(count, kMaxRules)) {
+    reset(0.0f, 0.0f);
+}
+
+void SpawnScheduler::reset(float distance, float time) {
+    const float now[kSpawnClockCount] = { distance, time };
+    for (Timeline& timeline : timelines_) {
+        timeline.count = 0;
+    }
+    for (std::size_t i = 0; i < ruleCount_; ++i) {
+        const std::size_t clock = static_cast<std::size_t>(rules_[i].clock);
+        push(clock, SpawnEvent{ now[clock] + rules_[i].interval, static_cast<std::uint8_t>(i) });
+    }
+}
+
+float SpawnScheduler::nextDue(SpawnClock clock) const {
+    const Timeline& timeline = timelines_[static_cast<std::size_t>(clock)];
+    return timeline.count > 0 ? timeline.events[0].due : std::numeric_limits<float>::infinity();
+}
+
+bool SpawnScheduler::popDue(std::size_t clock, float now, SpawnEvent& event) {
+    Timeline& timeline = timelines_[clock];
+    if (timeline.count == 0 || timeline.events[0].due > now) return false;
+    std::pop_heap(timeline.events.begin(), timeline.events.begin() + timeline.count, later);
+    event = timeline.events[--timeline.count];
+    return true;
+}
+
+void SpawnScheduler::push(std::size_t clock, const SpawnEvent& event) {
+    Timeline& timeline = timelines_[clock];
+    // Every rule has at most one pending event, so this never overflows
+    timeline.events[timeline.count++] = event;
+    std::push_heap(timeline.events.begin(), timeline.events.begin() + timeline.count, later);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+enum class SpawnClock : std::uint8_t {
+    Distance,  // metres run
+    Time,      // seconds of world time
+    Count
+};
+
+constexpr std::size_t kSpawnClockCount = static_cast<std::size_t>(SpawnClock::Count);
+
+enum class SpawnAction : std::uint8_t {
+    WalkerEnemy,
+    FlyerEnemy,
+    GoldenCarrot,
+    CoinPair
+};
+
+// Fires `action` every `interval` units of `clock`, counted from the last
+// firing, while world time is in [fromTime, untilTime). Outside that window
+// the rule still keeps its pace but does nothing. An interval of 0 fires once.
+struct SpawnRule {
+    SpawnAction action;
+    SpawnClock clock;
+    float interval;
+    float fromTime;
+    float untilTime;
+};
+
+struct SpawnEvent {
+    float due = 0.0f;       // clock value the rule fires at next
+    std::uint8_t rule = 0;  // index into the rule table
+};
+
+// Upcoming spawns as one min-heap per clock, so a tick only looks at the
+// events that are due. Storage is fixed, so the whole state can be copied
+// into a snapshot.
+class SpawnScheduler {
+public:
+    static constexpr std::size_t kMaxRules = 16;
+
+    struct Timeline {
+        std::array<SpawnEvent, kMaxRules> events{};  // binary heap on due
+        std::size_t count = 0;
+    };
+    using State = std::array<Timeline, kSpawnClockCount>;
+
+    // rules must outlive the scheduler; at most kMaxRules are used
+    SpawnScheduler(const SpawnRule* rules, std::size_t count);
+
+    // Schedules every rule one interval after the given clock values
+    void reset(float distance, float time);
+
+    // Calls fn(const SpawnRule&) for every rule due at these clock values,
+    // earliest first per clock, and reschedules it one interval from now
+    template <typename Fn>
+    void poll(float distance, float time, Fn fn) {
+        const float now[kSpawnClockCount] = { distance, time };
+        for (std::size_t clock = 0; clock < kSpawnClockCount; ++clock) {
+            SpawnEvent event;
+            while (popDue(clock, now[clock], event)) {
+                const SpawnRule& rule = rules_[event.rule];
+                if (time >= rule.fromTime && time < rule.untilTime) {
+                    fn(rule);
+                }
+                if (rule.interval > 0.0f) {
+                    push(clock, SpawnEvent{ now[clock] + rule.interval, event.rule });
+                }
+            }
+        }
+    }
+
+    // Clock value of the next event on a clock, infinity if there is none
+    float nextDue(SpawnClock clock) const;
+
+    const State& getState() const { return timelines_; }
+    void setState(const State& state) { timelines_ = state; }
+
+private:
+    bool popDue(std::size_t clock, float now, SpawnEvent& event);
+    void push(std::size_t clock, const SpawnEvent& event);
+
+    const SpawnRule* rules_;
+    std::size_t ruleCount_;
+    State timelines_;
+};
@@ -0,0 +1,266 @@
+#pragma once
+
+// Run telemetry wire format, shared by the in-game recorder and tools/.
+// Header-only and SFML-free on purpose.
+//
+// File layout: "BPTL", version byte, varint seed, zigzag varint start date,
+// then one record per tick. A record is a change-mask byte followed by
+// zigzag varint deltas against the previous tick. Position, velocity and
+// frame time are always present; the other fields only when they changed.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct TelemetryEvents {
+    enum : std::uint16_t {
+        Collect          = 1 << 0,
+        PowerUp          = 1 << 1,
+        EnemyKilled      = 1 << 2,
+        DamageCactus     = 1 << 3,
+        DamageEnemy      = 1 << 4,
+        DamageProjectile = 1 << 5,
+        DamageCeiling    = 1 << 6,
+        Death            = 1 << 7,
+        ScorePenalty     = 1 << 8,
+        ShieldBroken     = 1 << 9,
+        Rewind           = 1 << 10
+    };
+};
+
+struct TelemetryPowerUps {
+    enum : std::uint8_t {
+        Magnet       = 1 << 0,
+        Shield       = 1 << 1,
+        DoublePoints = 1 << 2,
+        SpeedBoost   = 1 << 3
+    };
+};
+
+struct TelemetrySample {
+    std::uint32_t tick = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float vx = 0.0f;
+    float vy = 0.0f;
+    std::uint8_t state = 0;
+    std::int32_t score = 0;
+    std::uint8_t lives = 0;
+    std::uint8_t powerUps = 0;
+    std::uint16_t events = 0;
+    float frameTime = 0.0f;  // seconds
+    float difficulty = 0.0f;
+};
+
+struct TelemetryHeader {
+    std::uint32_t seed = 0;
+    std::int64_t date = 0;
+    std::uint8_t version = 0;
+};
+
+namespace telemetry_detail {
+    constexpr char kMagic[4] = { 'B', 'P', 'T', 'L' };
+    constexpr std::uint8_t kVersion = 1;
+
+    // Fixed-point scales; deltas of these integers are what gets stored
+    constexpr float kPositionScale = 4.0f;     // quarter pixels
+    constexpr float kVelocityScale = 1.0f;     // px/s
+    constexpr float kFrameTimeScale = 10000.0f; // 0.1 ms
+    constexpr float kDifficultyScale = 100.0f;
+
+    enum MaskBits : std::uint8_t {
+        TickGap    = 1 << 0,
+        State      = 1 << 1,
+        Score      = 1 << 2,
+        Lives      = 1 << 3,
+        PowerUps   = 1 << 4,
+        Events     = 1 << 5,
+        Difficulty = 1 << 6
+    };
+
+    struct Quantized {
+        std::int64_t tick = -1;
+        std::int64_t x = 0, y = 0, vx = 0, vy = 0;
+        std::int64_t state = 0, score = 0, lives = 0, powerUps = 0, events = 0;
+        std::int64_t frameTime = 0, difficulty = 0;
+    };
+
+    inline std::int64_t quantize(float value, float scale) {
+        return static_cast<std::int64_t>(std::lround(value * scale));
+    }
+
+    inline std::uint64_t zigzag(std::int64_t value) {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    inline std::int64_t unzigzag(std::uint64_t value) {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    inline void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    inline bool readVarint(const std::uint8_t*& cursor, const std::uint8_t* end, std::uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (cursor == end) return false;
+            std::uint8_t byte = *cursor++;
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+    inline void writeDelta(std::vector<std::uint8_t>& out, std::int64_t current, std::int64_t previous) {
+        writeVarint(out, zigzag(current - previous));
+    }
+
+    inline bool readDelta(const std::uint8_t*& cursor, const std::uint8_t* end, std::int64_t& value) {
+        std::uint64_t raw = 0;
+        if (!readVarint(cursor, end, raw)) return false;
+        value += unzigzag(raw);
+        return true;
+    }
+}
+
+class TelemetryEncoder {
+public:
+    static void writeHeader(std::vector<std::uint8_t>& out, const TelemetryHeader& header) {
+        using namespace telemetry_detail;
+        out.insert(out.end(), kMagic, kMagic + 4);
+        out.push_back(kVersion);
+        writeVarint(out, header.seed);
+        writeVarint(out, zigzag(header.date));
+    }
+
+    void encode(const TelemetrySample& sample, std::vector<std::uint8_t>& out) {
+        using namespace telemetry_detail;
+        Quantized q;
+        q.tick = sample.tick;
+        q.x = quantize(sample.x, kPositionScale);
+        q.y = quantize(sample.y, kPositionScale);
+        q.vx = quantize(sample.vx, kVelocityScale);
+        q.vy = quantize(sample.vy, kVelocityScale);
+        q.state = sample.state;
+        q.score = sample.score;
+        q.lives = sample.lives;
+        q.powerUps = sample.powerUps;
+        q.events = sample.events;
+        q.frameTime = quantize(sample.frameTime, kFrameTimeScale);
+        q.difficulty = quantize(sample.difficulty, kDifficultyScale);
+
+        std::uint8_t mask = 0;
+        if (q.tick != prev_.tick + 1) mask |= TickGap;
+        if (q.state != prev_.state) mask |= State;
+        if (q.score != prev_.score) mask |= Score;
+        if (q.lives != prev_.lives) mask |= Lives;
+        if (q.powerUps != prev_.powerUps) mask |= PowerUps;
+        if (q.events != 0) mask |= Events;
+        if (q.difficulty != prev_.difficulty) mask |= Difficulty;
+
+        out.push_back(mask);
+        if (mask & TickGap) writeDelta(out, q.tick, prev_.tick);
+        writeDelta(out, q.x, prev_.x);
+        writeDelta(out, q.y, prev_.y);
+        writeDelta(out, q.vx, prev_.vx);
+        writeDelta(out, q.vy, prev_.vy);
+        writeDelta(out, q.frameTime, prev_.frameTime);
+        if (mask & State) writeDelta(out, q.state, prev_.state);
+        if (mask & Score) writeDelta(out, q.score, prev_.score);
+        if (mask & Lives) writeDelta(out, q.lives, prev_.lives);
+        if (mask & PowerUps) writeDelta(out, q.powerUps, prev_.powerUps);
+        if (mask & Events) writeVarint(out, static_cast<std::uint64_t>(q.events));
+        if (mask & Difficulty) writeDelta(out, q.difficulty, prev_.difficulty);
+
+        q.events = 0; // events are per tick, not deltas
+        prev_ = q;
+    }
+
+private:
+    telemetry_detail::Quantized prev_;
+};
+
+class TelemetryDecoder {
+public:
+    TelemetryDecoder(const std::uint8_t* data, std::size_t size)
+        : cursor_(data)
+        , end_(data + size) {
+    }
+
+    bool readHeader(TelemetryHeader& header) {
+        using namespace telemetry_detail;
+        if (end_ - cursor_ < 5) return false;
+        for (int i = 0; i < 4; ++i) {
+            if (cursor_[i] != static_cast<std::uint8_t>(kMagic[i])) return false;
+        }
+        cursor_ += 4;
+        header.version = *cursor_++;
+        if (header.version != kVersion) return false;
+        std::uint64_t seed = 0;
+        std::uint64_t date = 0;
+        if (!readVarint(cursor_, end_, seed) || !readVarint(cursor_, end_, date)) return false;
+        header.seed = static_cast<std::uint32_t>(seed);
+        header.date = unzigzag(date);
+        return true;
+    }
+
+    // Returns false at the end of the stream or on a truncated last record.
+    bool next(TelemetrySample& sample) {
+        using namespace telemetry_detail;
+        if (cursor_ == end_) return false;
+        const std::uint8_t* start = cursor_;
+        Quantized q = prev_;
+        q.events = 0;
+        const std::uint8_t mask = *cursor_++;
+
+        bool ok = true;
+        if (mask & TickGap) ok = ok && readDelta(cursor_, end_, q.tick);
+        else q.tick = prev_.tick + 1;
+        ok = ok && readDelta(cursor_, end_, q.x);
+        ok = ok && readDelta(cursor_, end_, q.y);
+        ok = ok && readDelta(cursor_, end_, q.vx);
+        ok = ok && readDelta(cursor_, end_, q.vy);
+        ok = ok && readDelta(cursor_, end_, q.frameTime);
+        if (mask & State) ok = ok && readDelta(cursor_, end_, q.state);
+        if (mask & Score) ok = ok && readDelta(cursor_, end_, q.score);
+        if (mask & Lives) ok = ok && readDelta(cursor_, end_, q.lives);
+        if (mask & PowerUps) ok = ok && readDelta(cursor_, end_, q.powerUps);
+        if (mask & Events) {
+            std::uint64_t events = 0;
+            ok = ok && readVarint(cursor_, end_, events);
+            q.events = static_cast<std::int64_t>(events);
+        }
+        if (mask & Difficulty) ok = ok && readDelta(cursor_, end_, q.difficulty);
+
+        if (!ok) {
+            cursor_ = start;
+            return false;
+        }
+
+        sample.tick = static_cast<std::uint32_t>(q.tick);
+        sample.x = static_cast<float>(q.x) / kPositionScale;
+        sample.y = static_cast<float>(q.y) / kPositionScale;
+        sample.vx = static_cast<float>(q.vx) / kVelocityScale;
+        sample.vy = static_cast<float>(q.vy) / kVelocityScale;
+        sample.state = static_cast<std::uint8_t>(q.state);
+        sample.score = static_cast<std::int32_t>(q.score);
+        sample.lives = static_cast<std::uint8_t>(q.lives);
+        sample.powerUps = static_cast<std::uint8_t>(q.powerUps);
+        sample.events = static_cast<std::uint16_t>(q.events);
+        sample.frameTime = static_cast<float>(q.frameTime) / kFrameTimeScale;
+        sample.difficulty = static_cast<float>(q.difficulty) / kDifficultyScale;
+        prev_ = q;
+        return true;
+    }
+
+private:
+    const std::uint8_t* cursor_;
+    const std::uint8_t* end_;
+    telemetry_detail::Quantized prev_;
+};
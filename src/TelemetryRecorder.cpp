@@ -0,0 +1,118 @@
+#include "TelemetryRecorder.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace {
+    const char* kTelemetryDirectory = "telemetry";
+    const std::size_t kWriteThreshold = 4096;
+
+    // Recorders whose runs ended, kept until their writers are joined
+    struct Retired {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<TelemetryRecorder>> recorders;
+    };
+
+    Retired& retired() {
+        static Retired instance;
+        return instance;
+    }
+}
+
+TelemetryRecorder::TelemetryRecorder(std::uint32_t seed, std::int64_t date)
+    : finishing_(false)
+    , closed_(false)
+    , dropped_(0) {
+    header_.seed = seed;
+    header_.date = date;
+    writer_ = std::thread(&TelemetryRecorder::run, this);
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    finish();
+}
+
+void TelemetryRecorder::record(const TelemetrySample& sample) {
+    if (!ring_.push(sample)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void TelemetryRecorder::retire(std::unique_ptr<TelemetryRecorder> recorder) {
+    if (!recorder) return;
+    // The writer sees the flag on its next pass and exits once the file is closed
+    recorder->finishing_.store(true, std::memory_order_release);
+    Retired& list = retired();
+    std::lock_guard<std::mutex> lock(list.mutex);
+    // Joining a writer that has closed its file does not wait on disk
+    auto& recorders = list.recorders;
+    recorders.erase(std::remove_if(recorders.begin(), recorders.end(),
+        [](const std::unique_ptr<TelemetryRecorder>& done) { return done->closed_.load(std::memory_order_acquire); }),
+        recorders.end());
+    recorders.push_back(std::move(recorder));
+}
+
+void TelemetryRecorder::flushRetired() {
+    std::vector<std::unique_ptr<TelemetryRecorder>> recorders;
+    {
+        Retired& list = retired();
+        std::lock_guard<std::mutex> lock(list.mutex);
+        recorders.swap(list.recorders);
+    }
+    // Destroying each recorder joins its writer
+}
+
+void TelemetryRecorder::finish() {
+    finishing_.store(true, std::memory_order_release);
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+void TelemetryRecorder::run() {
+    std::error_code error;
+    std::filesystem::create_directories(kTelemetryDirectory, error);
+
+    const std::string path = std::string(kTelemetryDirectory) + "/run_" +
+        std::to_string(header_.date) + "_" + std::to_string(header_.seed) + ".bpt";
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open telemetry file: " << path << std::endl;
+    }
+
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(kWriteThreshold * 2);
+    TelemetryEncoder::writeHeader(buffer, header_);
+    TelemetryEncoder encoder;
+
+    auto writeBuffer = [&]() {
+        if (file.is_open() && !buffer.empty()) {
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        }
+        buffer.clear();
+    };
+
+    TelemetrySample sample;
+    while (true) {
+        // Read the flag before draining so nothing pushed before finish() is lost
+        const bool finishing = finishing_.load(std::memory_order_acquire);
+        bool drained = false;
+        while (ring_.pop(sample)) {
+            encoder.encode(sample, buffer);
+            drained = true;
+        }
+        if (buffer.size() >= kWriteThreshold || finishing) {
+            writeBuffer();
+        }
+        if (finishing) break;
+        if (!drained) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(4));
+        }
+    }
+    file.close();
+    closed_.store(true, std::memory_order_release);
+}
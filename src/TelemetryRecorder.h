@@ -0,0 +1,45 @@
+#pragma once
+
+#include "SpscRing.h"
+#include "TelemetryFormat.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Streams one TelemetrySample per tick to telemetry/run_<date>_<seed>.bpt.
+// record() is wait-free for the sim thread; encoding and disk writes happen
+// on a background thread. Samples are dropped (and counted) if the writer
+// falls more than a ring's worth behind.
+class TelemetryRecorder {
+public:
+    TelemetryRecorder(std::uint32_t seed, std::int64_t date);
+    // Blocks until the writer has closed the file; see retire()
+    ~TelemetryRecorder();
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    void record(const TelemetrySample& sample);
+
+    // Never blocks: stops the run and keeps the recorder alive while its
+    // writer drains the remaining samples and closes the file. Recorders
+    // whose writers are already done are released here.
+    static void retire(std::unique_ptr<TelemetryRecorder> recorder);
+    // Blocks until every retired recorder has finished writing. Call at shutdown.
+    static void flushRetired();
+
+    std::uint32_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void finish();
+    void run();
+
+    SpscRing<TelemetrySample, 1024> ring_;
+    TelemetryHeader header_;
+    std::atomic<bool> finishing_;
+    std::atomic<bool> closed_;  // the writer has closed the file and is exiting
+    std::atomic<std::uint32_t> dropped_;
+    std::thread writer_;
+};
@@ -0,0 +1,77 @@
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cmath>
+
+TimerWheel::TimerWheel() {
+    clear();
+}
+
+std::uint32_t TimerWheel::tickAt(float time) {
+    return static_cast<std::uint32_t>(std::max(0.0f, std::floor(time / kTickSeconds)));
+}
+
+void TimerWheel::start(std::size_t id, float seconds) {
+    if (isActive(id)) unlink(id);
+    const float due = std::ceil((time_ + seconds) / kTickSeconds);
+    expiry_[id] = std::max(now_ + 1, static_cast<std::uint32_t>(std::max(0.0f, due)));
+    link(id);
+}
+
+void TimerWheel::cancel(std::size_t id) {
+    if (isActive(id)) unlink(id);
+}
+
+void TimerWheel::clear() {
+    time_ = 0.0f;
+    now_ = 0;
+    heads_.fill(kNone);
+    expiry_.fill(0);
+    slots_.fill(kNone);
+    next_.fill(kNone);
+    prev_.fill(kNone);
+}
+
+float TimerWheel::remaining(std::size_t id) const {
+    if (!isActive(id)) return 0.0f;
+    return static_cast<float>(expiry_[id] - now_) * kTickSeconds;
+}
+
+void TimerWheel::restore(float worldTime, const std::array<float, kMaxTimers>& remaining) {
+    clear();
+    time_ = worldTime;
+    now_ = tickAt(worldTime);
+    for (std::size_t id = 0; id < kMaxTimers; ++id) {
+        if (remaining[id] > 0.0f) start(id, remaining[id]);
+    }
+}
+
+std::size_t TimerWheel::collectExpired() {
+    std::size_t count = 0;
+    std::uint8_t id = heads_[now_ % kSlotCount];
+    while (id != kNone) {
+        const std::uint8_t next = next_[id];
+        // Timers a whole turn or more away share the slot; leave them
+        if (expiry_[id] <= now_) {
+            unlink(id);
+            expired_[count++] = id;
+        }
+        id = next;
+    }
+    return count;
+}
+
+void TimerWheel::link(std::size_t id) {
+    const std::uint8_t slot = static_cast<std::uint8_t>(expiry_[id] % kSlotCount);
+    slots_[id] = slot;
+    prev_[id] = kNone;
+    next_[id] = heads_[slot];
+    if (heads_[slot] != kNone) prev_[heads_[slot]] = static_cast<std::uint8_t>(id);
+    heads_[slot] = static_cast<std::uint8_t>(id);
+}
+
+void TimerWheel::unlink(std::size_t id) {
+    if (prev_[id] != kNone) next_[prev_[id]] = next_[id];
+    else heads_[slots_[id]] = next_[id];
+    if (next_[id] != kNone) prev_[next_[id]] = prev_[id];
+    slots_[id] = kNone;
+}
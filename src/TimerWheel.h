@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Expiry timers for timed effects, hashed into a wheel of slots by their
+// expiry tick. Advancing the clock only visits the slots it passes, so a
+// tick touches just the timers that may be expiring. Timers are identified
+// by a small fixed id, so starting one again replaces its expiry.
+class TimerWheel {
+public:
+    static constexpr std::size_t kMaxTimers = 16;
+    static constexpr std::size_t kSlotCount = 64;
+    static constexpr float kTickSeconds = 1.0f / 60.0f;
+
+    TimerWheel();
+
+    // Expires `seconds` after the current time, replacing any earlier start
+    void start(std::size_t id, float seconds);
+    void cancel(std::size_t id);
+    void clear();
+
+    bool isActive(std::size_t id) const { return slots_[id] != kNone; }
+    // Whole ticks until expiry in seconds, 0 if the timer is not running
+    float remaining(std::size_t id) const;
+
+    // Moves the clock forward to worldTime and calls fn(id) for every timer
+    // that expired on the way, tick by tick. fn may start or cancel timers.
+    template <typename Fn>
+    void advance(float worldTime, Fn fn) {
+        const std::uint32_t target = tickAt(worldTime);
+        time_ = worldTime;
+        while (now_ < target) {
+            ++now_;
+            std::size_t count = collectExpired();
+            for (std::size_t i = 0; i < count; ++i) {
+                fn(expired_[i]);
+            }
+        }
+    }
+
+    // Restores the clock and the timers' remaining seconds, e.g. after a rewind
+    void restore(float worldTime, const std::array<float, kMaxTimers>& remaining);
+
+private:
+    static constexpr std::uint8_t kNone = 0xFF;
+
+    static std::uint32_t tickAt(float time);
+
+    // Unlinks the timers in the current slot that expire now, into expired_
+    std::size_t collectExpired();
+    void link(std::size_t id);
+    void unlink(std::size_t id);
+
+    float time_;
+    std::uint32_t now_;
+    std::array<std::uint8_t, kSlotCount> heads_;  // first timer per slot
+    // Per timer: expiry tick, slot (kNone if not running), list links
+    std::array<std::uint32_t, kMaxTimers> expiry_;
+    std::array<std::uint8_t, kMaxTimers> slots_;
+    std::array<std::uint8_t, kMaxTimers> next_;
+    std::array<std::uint8_t, kMaxTimers> prev_;
+    std::array<std::uint8_t, kMaxTimers> expired_;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+// Trait tables are std::arrays indexed by an enum, sized by its Count value,
+// where every entry names the enum value it describes. A missing or
+// misordered entry leaves some slot with the wrong type (trailing slots are
+// zero-filled), so this check catches both at compile time.
+template <typename Table>
+constexpr bool coversEveryValue(const Table& table) {
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        if (static_cast<std::size_t>(table[i].type) != i) return false;
+    }
+    return true;
+}
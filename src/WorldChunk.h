@@ -0,0 +1,24 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Platform.h"
+#include "CollectibleField.h"
+#include "GroundHeightfield.h"
+#include <vector>
+
+// A fixed-width slice of the level. Everything generated in the slice lives
+// in the chunk's own contiguous storage and is dropped with it once the
+// camera has moved past. Generated content stays inside the chunk's bounds;
+// only moving platforms swing a little past them. Decorations are not
+// chunk content: they live in one x-sorted DecorationStore.
+struct WorldChunk {
+    static constexpr float kWidth = 2048.0f;
+
+    int index = 0;
+    GroundHeightfield ground;
+    std::vector<Platform> platforms;
+    CollectibleField collectibles;
+
+    float startX() const { return static_cast<float>(index) * kWidth; }
+    float endX() const { return startX() + kWidth; }
+};
@@ -0,0 +1,270 @@
+#include "WorldGenerator.h"
+#include "WorldChunk.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+namespace {
+    const float kGroundY = 600.0f;
+    const float kGroundHeight = 140.0f;
+    const float kMinGroundWidth = 420.0f;
+    const float kMaxGroundWidth = 800.0f;
+    const float kPlatformHeight = 32.0f;
+    const float kFirstPlatformX = 800.0f;
+    const float kPixelsPerMeter = 50.0f;
+
+    template <typename Array>
+    void append(Array& items, std::size_t& count, const typename Array::value_type& item) {
+        if (count < items.size()) {
+            items[count++] = item;
+        }
+    }
+
+    // Everything one chunk's generation reads or writes
+    struct ChunkBuilder {
+        const DecorationMetrics& metrics;
+        CounterRng rng;
+        ChunkDescription& chunk;
+
+        float startX() const { return static_cast<float>(chunk.index) * WorldChunk::kWidth; }
+        float endX() const { return startX() + WorldChunk::kWidth; }
+        sf::Vector2f sizeOf(DecorationKind kind) const { return metrics.sizes[static_cast<std::size_t>(kind)]; }
+        bool has(DecorationKind kind) const { return metrics.available[static_cast<std::size_t>(kind)]; }
+
+        void addDecoration(DecorationKind kind, float x, float y, float scale) {
+            DecorationSpawn deco;
+            deco.kind = kind;
+            deco.position = sf::Vector2f(x, y);
+            deco.scale = scale;
+            append(chunk.decorations, chunk.decorationCount, deco);
+        }
+
+        bool overlapsDecoration(DecorationKind kind, float x, float y, float scale) const {
+            const sf::Vector2f size = sizeOf(kind) * scale;
+            for (std::size_t i = 0; i < chunk.decorationCount; ++i) {
+                const DecorationSpawn& other = chunk.decorations[i];
+                const sf::Vector2f otherSize = sizeOf(other.kind) * other.scale;
+                if (x < other.position.x + otherSize.x && other.position.x < x + size.x &&
+                    y < other.position.y + otherSize.y && other.position.y < y + size.y) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Platforms never leave their chunk, so only this chunk's need checking
+        bool isUnderPlatform(float left, float top, float width) const {
+            for (std::size_t i = 0; i < chunk.platformCount; ++i) {
+                const PlatformSpawn& plat = chunk.platforms[i];
+                float bottom = plat.position.y + plat.size.y;
+                // Platform is above ground, below the top of the bounds and horizontally overlaps
+                if (plat.position.x < left + width &&
+                    plat.position.x + plat.size.x > left &&
+                    bottom < kGroundY &&
+                    bottom > top) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void spawnCollectiblePattern(const PlatformSpawn& platform) {
+            if (platform.size.x < 120.0f) return;
+
+            float topY = platform.position.y - 18.0f;
+            int count = std::clamp(static_cast<int>(platform.size.x / 60.0f), 2, 7);
+            float startX = platform.position.x + 20.0f;
+            float step = (platform.size.x - 40.0f) / std::max(1, count - 1);
+            float roll = rng.unit();
+
+            auto placeCollectible = [&](const sf::Vector2f& pos, CollectibleType type, CollectiblePattern pattern) {
+                append(chunk.collectibles, chunk.collectibleCount, CollectibleSpawn{ pos, type, pattern });
+                };
+
+            if (roll < 0.5f) {
+                // Simple, readable horizontal line of carrots
+                for (int i = 0; i < count; ++i) {
+                    placeCollectible({ startX + step * i, topY }, CollectibleType::Coin, CollectiblePattern::Line);
+                }
+            }
+            else if (roll < 0.85f) {
+                // Gentle zig-zag carrots across the platform
+                for (int i = 0; i < count; ++i) {
+                    float zigzag = (i % 2 == 0) ? -18.0f : 12.0f;
+                    placeCollectible({ startX + step * i, topY + zigzag }, CollectibleType::Coin, CollectiblePattern::ZigZag);
+                }
+            }
+            else {
+                // Small cluster of golden carrots near the far end for higher risk/reward
+                int gems = std::min(3, count);
+                float baseX = startX + step * (count - 1) - 30.0f;
+                for (int i = 0; i < gems; ++i) {
+                    float offsetX = rng.uniform(-10.0f, 20.0f);
+                    float offsetY = -rng.uniform(0.0f, 16.0f);
+                    placeCollectible({ baseX + offsetX, topY + offsetY }, CollectibleType::Gem, CollectiblePattern::GemCluster);
+                }
+            }
+
+            if (rng.chance(0.18f)) {
+                CollectibleType powerType = CollectibleType::Magnet;
+                float powerRoll = rng.unit();
+                if (powerRoll < 0.25f) powerType = CollectibleType::Magnet;
+                else if (powerRoll < 0.5f) powerType = CollectibleType::Shield;
+                else if (powerRoll < 0.75f) powerType = CollectibleType::SpeedBoost;
+                else powerType = CollectibleType::DoublePoints;
+
+                placeCollectible({ platform.position.x + platform.size.x / 2.0f, topY - 24.0f }, powerType, CollectiblePattern::PowerUp);
+            }
+        }
+
+        void generateFloatingPlatforms() {
+            // Gaps tighten with the chunk's distance into the run
+            float distance = std::max(0.0f, startX() / kPixelsPerMeter);
+            float difficulty = 1.0f + distance / 800.0f;
+            float minGap = std::max(80.0f, 140.0f - difficulty * 6.0f);
+            float maxGap = std::max(140.0f, 280.0f - difficulty * 10.0f);
+
+            float x = startX() + (chunk.index == 0 ? kFirstPlatformX : 0.0f);
+            while (true) {
+                x += rng.uniform(minGap, maxGap);
+                float width = rng.uniform(160.0f, 360.0f);
+                if (x + width > endX()) break;
+                float height = rng.uniform(300.0f, 520.0f);
+
+                PlatformType type = PlatformType::Normal;
+                float roll = rng.unit();
+                if (roll > 0.8f) type = PlatformType::MovingHorizontal;
+                if (roll > 0.9f) type = PlatformType::Bouncy;
+                if (roll > 0.95f) type = PlatformType::Ice;
+
+                PlatformSpawn platform;
+                platform.position = sf::Vector2f(x, height);
+                platform.size = sf::Vector2f(width, kPlatformHeight);
+                platform.type = type;
+                platform.movementRange = platformTraits(type).motion != PlatformMotion::None
+                    ? rng.uniform(60.0f, 140.0f)
+                    : 0.0f;
+                platform.movementSpeed = (platform.movementRange > 0.0f) ? rng.uniform(50.0f, 90.0f) : 0.0f;
+                // Seeded, so a platform is in the same place at the same world time in every run
+                platform.phase = (platform.movementRange > 0.0f) ? rng.uniform(0.0f, 4.0f * platform.movementRange) : 0.0f;
+
+                spawnCollectiblePattern(platform);
+
+                // Add a visible spring on bouncy platforms so jumps feel more readable
+                if (type == PlatformType::Bouncy && has(DecorationKind::Spring)) {
+                    float scale = 0.7f;
+                    sf::Vector2f springSize = sizeOf(DecorationKind::Spring);
+                    addDecoration(DecorationKind::Spring,
+                        x + width * 0.5f - springSize.x * scale / 2.0f,
+                        height - springSize.y * scale,
+                        scale);
+                }
+
+                append(chunk.platforms, chunk.platformCount, platform);
+                x += width;
+            }
+        }
+
+        void generateGround() {
+            struct CactusRequest { float x; float y; float scale; };
+            std::array<CactusRequest, ChunkDescription::kMaxGround> cactusRequests;
+            std::size_t cactusCount = 0;
+
+            float x = startX();
+            while (x < endX()) {
+                float width = rng.uniform(kMinGroundWidth, kMaxGroundWidth);
+                // Segments end exactly on the chunk boundary; absorb a short remainder
+                if (endX() - (x + width) < kMinGroundWidth) {
+                    width = endX() - x;
+                }
+                PlatformSpawn ground;
+                ground.position = sf::Vector2f(x, kGroundY);
+                ground.size = sf::Vector2f(width, kGroundHeight);
+
+                // Save cactus spawn requests for after the whole chunk is generated
+                if (has(DecorationKind::Cactus) && rng.chance(0.4f)) {
+                    float cactusScale = 0.5f;
+                    float cactusX = x + rng.uniform(40.0f, width - 40.0f);
+                    float cactusY = kGroundY - sizeOf(DecorationKind::Cactus).y * cactusScale;
+                    append(cactusRequests, cactusCount, CactusRequest{ cactusX, cactusY, cactusScale });
+                }
+                // Red mushrooms are safe, brown ones cost points; skip either if it overlaps
+                for (DecorationKind kind : { DecorationKind::RedMushroom, DecorationKind::BrownMushroom }) {
+                    float probability = (kind == DecorationKind::RedMushroom) ? 0.4f : 0.5f;
+                    if (!has(kind) || !rng.chance(probability)) continue;
+                    float mushScale = 0.5f;
+                    float mushX = x + rng.uniform(40.0f, width - 40.0f);
+                    float mushY = kGroundY - sizeOf(kind).y * mushScale;
+                    if (!overlapsDecoration(kind, mushX, mushY, mushScale)) {
+                        addDecoration(kind, mushX, mushY, mushScale);
+                    }
+                }
+
+                append(chunk.ground, chunk.groundCount, ground);
+                x += width;
+            }
+
+            // Place cacti only if not under a platform
+            const float cactusWidth = sizeOf(DecorationKind::Cactus).x;
+            for (std::size_t i = 0; i < cactusCount; ++i) {
+                const CactusRequest& request = cactusRequests[i];
+                if (!isUnderPlatform(request.x, request.y, cactusWidth * request.scale)) {
+                    addDecoration(DecorationKind::Cactus, request.x, request.y, request.scale);
+                }
+            }
+        }
+    };
+}
+
+WorldGenerator::WorldGenerator(std::uint32_t runSeed, const DecorationMetrics& metrics)
+    : metrics_(metrics)
+    , runSeed_(runSeed)
+    , nextIndex_(0)
+    , stopping_(false) {
+    // Fill the ring before the worker exists; the thread start orders these
+    // pushes before anything the worker does
+    auto chunk = std::make_unique<ChunkDescription>();
+    for (std::size_t i = 0; i < kReadyChunks; ++i) {
+        generateChunk(runSeed_, nextIndex_++, metrics_, *chunk);
+        ready_.push(*chunk);
+    }
+    worker_ = std::thread(&WorldGenerator::run, this);
+}
+
+WorldGenerator::~WorldGenerator() {
+    stopping_.store(true, std::memory_order_release);
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool WorldGenerator::poll(ChunkDescription& chunk) {
+    return ready_.pop(chunk);
+}
+
+void WorldGenerator::generateChunk(std::uint32_t runSeed, int index, const DecorationMetrics& metrics,
+    ChunkDescription& chunk) {
+    chunk.index = index;
+    chunk.groundCount = 0;
+    chunk.platformCount = 0;
+    chunk.collectibleCount = 0;
+    chunk.decorationCount = 0;
+
+    ChunkBuilder builder{ metrics, CounterRng(chunkSeed(runSeed, index)), chunk };
+    // Floating platforms first so ground decorations can check against them
+    builder.generateFloatingPlatforms();
+    builder.generateGround();
+}
+
+void WorldGenerator::run() {
+    auto pending = std::make_unique<ChunkDescription>();
+    generateChunk(runSeed_, nextIndex_++, metrics_, *pending);
+    while (!stopping_.load(std::memory_order_acquire)) {
+        if (ready_.push(*pending)) {
+            generateChunk(runSeed_, nextIndex_++, metrics_, *pending);
+        }
+        else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(4));
+        }
+    }
+}
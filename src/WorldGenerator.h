@@ -0,0 +1,101 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include "Platform.h"
+#include "Collectible.h"
+#include "Decoration.h"
+#include "SpscRing.h"
+#include "Random.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+struct PlatformSpawn {
+    sf::Vector2f position;
+    sf::Vector2f size;
+    PlatformType type = PlatformType::Normal;
+    float movementRange = 0.0f;
+    float movementSpeed = 0.0f;
+    float phase = 0.0f;  // distance already travelled at world time 0
+};
+
+// Which generation pattern placed a collectible
+enum class CollectiblePattern : std::uint8_t {
+    Line,
+    ZigZag,
+    GemCluster,
+    PowerUp
+};
+
+struct CollectibleSpawn {
+    sf::Vector2f position;
+    CollectibleType type = CollectibleType::Coin;
+    CollectiblePattern pattern = CollectiblePattern::Line;
+};
+
+struct DecorationSpawn {
+    DecorationKind kind = DecorationKind::Cactus;
+    sf::Vector2f position;
+    float scale = 1.0f;
+};
+
+// Everything needed to build one WorldChunk, as plain data so it can be
+// produced off the sim thread and copied through a ring. Spawns that do not
+// fit are dropped; the limits are well above what generation produces.
+struct ChunkDescription {
+    static constexpr std::size_t kMaxGround = 8;
+    static constexpr std::size_t kMaxPlatforms = 16;
+    static constexpr std::size_t kMaxCollectibles = 128;
+    static constexpr std::size_t kMaxDecorations = 32;
+
+    int index = 0;
+    std::array<PlatformSpawn, kMaxGround> ground;
+    std::array<PlatformSpawn, kMaxPlatforms> platforms;
+    std::array<CollectibleSpawn, kMaxCollectibles> collectibles;
+    std::array<DecorationSpawn, kMaxDecorations> decorations;
+    std::size_t groundCount = 0;
+    std::size_t platformCount = 0;
+    std::size_t collectibleCount = 0;
+    std::size_t decorationCount = 0;
+};
+
+// Texture sizes the generator needs for placement. Read from ResourceManager
+// on the sim thread up front, since ResourceManager is not thread-safe.
+struct DecorationMetrics {
+    std::array<sf::Vector2f, kDecorationKindCount> sizes{};
+    std::array<bool, kDecorationKindCount> available{};
+};
+
+// Generates chunk descriptions on a background thread, in index order, and
+// hands them to the sim thread through a lock-free ring. The first chunks
+// are generated in the constructor so the opening frames never wait.
+class WorldGenerator {
+public:
+    WorldGenerator(std::uint32_t runSeed, const DecorationMetrics& metrics);
+    ~WorldGenerator();
+
+    WorldGenerator(const WorldGenerator&) = delete;
+    WorldGenerator& operator=(const WorldGenerator&) = delete;
+
+    // Sim thread. Returns false if the next chunk is not ready yet.
+    bool poll(ChunkDescription& chunk);
+
+    // A chunk depends only on the run seed, its index and the metrics, so any
+    // chunk can be built on any thread, in any order.
+    static void generateChunk(std::uint32_t runSeed, int index, const DecorationMetrics& metrics,
+        ChunkDescription& chunk);
+
+private:
+    void run();
+
+    static constexpr std::size_t kReadyChunks = 2;
+
+    DecorationMetrics metrics_;
+    std::uint32_t runSeed_;
+    int nextIndex_;
+    std::atomic<bool> stopping_;
+    SpscRing<ChunkDescription, kReadyChunks> ready_;
+    std::thread worker_;
+};
@@ -1,5 +1,7 @@
 #include "Game.h"
 #include "ResourceManager.h"
+#include "ScoreStore.h"
+#include "TelemetryRecorder.h"
 #include <iostream>
 
 int main() {
@@ -7,6 +9,9 @@ int main() {
         // Load resources
         auto& rm = ResourceManager::getInstance();
 
+        // Start reading the leaderboard while assets load
+        ScoreStore::getInstance();
+
         // Load textures - using actual asset files from project root
         // Player sprites (bunny character)
         rm.loadTexture("player_idle", "bunny1_stand.png");
@@ -33,6 +38,10 @@ int main() {
 
         // Platforms
         rm.loadTexture("platform", "ground_grass.png");
+        // The ground strip tiles its own copy, so platforms keep clamping
+        if (rm.loadTexture("ground", "ground_grass.png")) {
+            rm.getTexture("ground").setRepeated(true);
+        }
         rm.loadTexture("platform_cake", "ground_cake.png");
         rm.loadTexture("platform_sand", "ground_sand.png");
 
@@ -62,9 +71,13 @@ int main() {
         // Load font
         rm.loadFont("default", "Baloo2-VariableFont_wght.ttf");
 
-        // Create and run game
-        Game game;
-        game.run();
+        // Create and run game; destroying it retires a run still in progress
+        {
+            Game game;
+            game.run();
+        }
+        ScoreStore::getInstance().flush();
+        TelemetryRecorder::flushRetired();
 
     }
     catch (const std::exception& e) {
@@ -0,0 +1,374 @@
+// Offline analyzer for telemetry/*.bpt run logs written by TelemetryRecorder.
+//
+// Usage: TelemetryAnalyzer <log directory> [--threads N] [--csv <output directory>]
+//
+// Every log is memory-mapped and decoded on a pool of worker threads; the
+// per-file results are merged at the end. Reports:
+//   - death locations by cause (cactus, enemy, projectile, ceiling bump)
+//   - power-up uptime
+//   - difficulty versus distance
+//   - frame-time histogram
+
+#include "TelemetryFormat.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const float kPixelsPerMeter = 50.0f;
+    const float kPlayerStartX = 100.0f;
+    const int kDistanceBinMeters = 50;
+    const int kDistanceBins = 80;       // 0 - 4000 m, last bin is open ended
+    const int kHeightBinPixels = 60;
+    const int kHeightBins = 12;         // 0 - 720 px
+    const int kDifficultyBinMeters = 100;
+    const int kDifficultyBins = 60;
+    const int kFrameTimeBins = 51;      // 1 ms bins, last bin is >= 50 ms
+
+    enum DeathCause {
+        CauseCactus,
+        CauseEnemy,
+        CauseProjectile,
+        CauseCeiling,
+        CauseUnknown,
+        CauseCount
+    };
+
+    const char* kCauseNames[CauseCount] = { "cactus", "enemy", "projectile", "ceiling", "unknown" };
+
+    const char* kPowerUpNames[4] = { "magnet", "shield", "double points", "speed boost" };
+
+    struct Report {
+        std::uint64_t files = 0;
+        std::uint64_t badFiles = 0;
+        std::uint64_t ticks = 0;
+        double seconds = 0.0;
+        std::array<std::array<std::array<std::uint32_t, kHeightBins>, kDistanceBins>, CauseCount> deaths{};
+        std::array<std::uint32_t, CauseCount> deathTotals{};
+        std::array<double, 4> powerUpSeconds{};
+        std::array<double, kDifficultyBins> difficultySum{};
+        std::array<std::uint64_t, kDifficultyBins> difficultyCount{};
+        std::array<std::uint64_t, kFrameTimeBins> frameTimes{};
+
+        void merge(const Report& other) {
+            files += other.files;
+            badFiles += other.badFiles;
+            ticks += other.ticks;
+            seconds += other.seconds;
+            for (int c = 0; c < CauseCount; ++c) {
+                deathTotals[c] += other.deathTotals[c];
+                for (int d = 0; d < kDistanceBins; ++d) {
+                    for (int h = 0; h < kHeightBins; ++h) {
+                        deaths[c][d][h] += other.deaths[c][d][h];
+                    }
+                }
+            }
+            for (int i = 0; i < 4; ++i) powerUpSeconds[i] += other.powerUpSeconds[i];
+            for (int i = 0; i < kDifficultyBins; ++i) {
+                difficultySum[i] += other.difficultySum[i];
+                difficultyCount[i] += other.difficultyCount[i];
+            }
+            for (int i = 0; i < kFrameTimeBins; ++i) frameTimes[i] += other.frameTimes[i];
+        }
+    };
+
+    // Read-only memory mapping of a whole file
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+            file_ = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE) return;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) return;
+            mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping_) return;
+            data_ = static_cast<const std::uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (data_) size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+            fd_ = open(path.c_str(), O_RDONLY);
+            if (fd_ < 0) return;
+            struct stat info;
+            if (fstat(fd_, &info) != 0 || info.st_size == 0) return;
+            void* mapped = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (mapped == MAP_FAILED) return;
+            data_ = static_cast<const std::uint8_t*>(mapped);
+            size_ = static_cast<std::size_t>(info.st_size);
+            madvise(mapped, size_, MADV_SEQUENTIAL);
+#endif
+        }
+
+        ~MappedFile() {
+#ifdef _WIN32
+            if (data_) UnmapViewOfFile(data_);
+            if (mapping_) CloseHandle(mapping_);
+            if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+            if (data_) munmap(const_cast<std::uint8_t*>(data_), size_);
+            if (fd_ >= 0) close(fd_);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const std::uint8_t* data() const { return data_; }
+        std::size_t size() const { return size_; }
+
+    private:
+        const std::uint8_t* data_ = nullptr;
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = nullptr;
+#else
+        int fd_ = -1;
+#endif
+    };
+
+    int clampBin(int bin, int count) {
+        return std::min(std::max(bin, 0), count - 1);
+    }
+
+    DeathCause causeFromEvents(std::uint16_t events) {
+        if (events & TelemetryEvents::DamageCactus) return CauseCactus;
+        if (events & TelemetryEvents::DamageEnemy) return CauseEnemy;
+        if (events & TelemetryEvents::DamageProjectile) return CauseProjectile;
+        if (events & TelemetryEvents::DamageCeiling) return CauseCeiling;
+        return CauseUnknown;
+    }
+
+    void analyzeFile(const std::filesystem::path& path, Report& report) {
+        MappedFile file(path);
+        if (!file.data()) {
+            ++report.badFiles;
+            return;
+        }
+
+        TelemetryDecoder decoder(file.data(), file.size());
+        TelemetryHeader header;
+        if (!decoder.readHeader(header)) {
+            ++report.badFiles;
+            return;
+        }
+        ++report.files;
+
+        DeathCause lastCause = CauseUnknown;
+        TelemetrySample sample;
+        while (decoder.next(sample)) {
+            ++report.ticks;
+            report.seconds += sample.frameTime;
+
+            const float meters = std::max(0.0f, (sample.x - kPlayerStartX) / kPixelsPerMeter);
+
+            if (sample.events) {
+                DeathCause cause = causeFromEvents(sample.events);
+                if (cause != CauseUnknown) lastCause = cause;
+            }
+            if (sample.events & TelemetryEvents::Death) {
+                int d = clampBin(static_cast<int>(meters) / kDistanceBinMeters, kDistanceBins);
+                int h = clampBin(static_cast<int>(sample.y) / kHeightBinPixels, kHeightBins);
+                ++report.deaths[lastCause][d][h];
+                ++report.deathTotals[lastCause];
+            }
+
+            for (int i = 0; i < 4; ++i) {
+                if (sample.powerUps & (1 << i)) report.powerUpSeconds[i] += sample.frameTime;
+            }
+
+            int difficultyBin = clampBin(static_cast<int>(meters) / kDifficultyBinMeters, kDifficultyBins);
+            report.difficultySum[difficultyBin] += sample.difficulty;
+            ++report.difficultyCount[difficultyBin];
+
+            int frameBin = clampBin(static_cast<int>(sample.frameTime * 1000.0f), kFrameTimeBins);
+            ++report.frameTimes[frameBin];
+        }
+    }
+
+    void printReport(const Report& report) {
+        std::cout << "Runs: " << report.files << " (" << report.badFiles << " unreadable), "
+            << report.ticks << " ticks, " << std::fixed << std::setprecision(1) << report.seconds << " s of play\n\n";
+
+        std::cout << "Deaths by cause\n";
+        const char* shades = " .:-=+*#%@";
+        for (int c = 0; c < CauseCount; ++c) {
+            if (report.deathTotals[c] == 0) continue;
+            std::cout << "  " << kCauseNames[c] << ": " << report.deathTotals[c] << "\n";
+
+            std::uint32_t peak = 0;
+            int lastBin = 0;
+            for (int d = 0; d < kDistanceBins; ++d) {
+                for (int h = 0; h < kHeightBins; ++h) {
+                    if (report.deaths[c][d][h]) lastBin = d;
+                    peak = std::max(peak, report.deaths[c][d][h]);
+                }
+            }
+            // Rows are screen height bands, columns are 50 m distance bins
+            for (int h = 0; h < kHeightBins; ++h) {
+                std::cout << "    " << std::setw(3) << h * kHeightBinPixels << "px |";
+                for (int d = 0; d <= lastBin; ++d) {
+                    std::uint32_t count = report.deaths[c][d][h];
+                    int shade = count == 0 ? 0 : 1 + static_cast<int>(8.0 * count / std::max<std::uint32_t>(1, peak));
+                    std::cout << shades[std::min(shade, 9)];
+                }
+                std::cout << "|\n";
+            }
+        }
+
+        std::cout << "\nPower-up uptime\n";
+        for (int i = 0; i < 4; ++i) {
+            double share = report.seconds > 0.0 ? 100.0 * report.powerUpSeconds[i] / report.seconds : 0.0;
+            std::cout << "  " << std::setw(14) << std::left << kPowerUpNames[i] << std::right
+                << std::setw(9) << std::setprecision(1) << report.powerUpSeconds[i] << " s  "
+                << std::setw(5) << share << " %\n";
+        }
+
+        std::cout << "\nDifficulty vs distance\n";
+        for (int i = 0; i < kDifficultyBins; ++i) {
+            if (report.difficultyCount[i] == 0) continue;
+            std::cout << "  " << std::setw(5) << i * kDifficultyBinMeters << " m  "
+                << std::setprecision(2) << report.difficultySum[i] / report.difficultyCount[i] << "\n";
+        }
+
+        std::cout << "\nFrame time histogram\n";
+        std::uint64_t peak = *std::max_element(report.frameTimes.begin(), report.frameTimes.end());
+        for (int i = 0; i < kFrameTimeBins; ++i) {
+            if (report.frameTimes[i] == 0) continue;
+            int bar = peak ? static_cast<int>(50.0 * report.frameTimes[i] / peak) : 0;
+            std::cout << "  " << (i == kFrameTimeBins - 1 ? ">=" : "  ") << std::setw(2) << i << " ms "
+                << std::setw(9) << report.frameTimes[i] << " " << std::string(static_cast<std::size_t>(bar), '#') << "\n";
+        }
+    }
+
+    void writeCsv(const Report& report, const std::filesystem::path& directory) {
+        std::filesystem::create_directories(directory);
+
+        std::ofstream deaths(directory / "deaths.csv");
+        deaths << "cause,distance_m,height_px,count\n";
+        for (int c = 0; c < CauseCount; ++c) {
+            for (int d = 0; d < kDistanceBins; ++d) {
+                for (int h = 0; h < kHeightBins; ++h) {
+                    if (report.deaths[c][d][h] == 0) continue;
+                    deaths << kCauseNames[c] << ',' << d * kDistanceBinMeters << ','
+                        << h * kHeightBinPixels << ',' << report.deaths[c][d][h] << '\n';
+                }
+            }
+        }
+
+        std::ofstream uptime(directory / "powerups.csv");
+        uptime << "powerup,seconds,share\n";
+        for (int i = 0; i < 4; ++i) {
+            uptime << kPowerUpNames[i] << ',' << report.powerUpSeconds[i] << ','
+                << (report.seconds > 0.0 ? report.powerUpSeconds[i] / report.seconds : 0.0) << '\n';
+        }
+
+        std::ofstream difficulty(directory / "difficulty.csv");
+        difficulty << "distance_m,difficulty,samples\n";
+        for (int i = 0; i < kDifficultyBins; ++i) {
+            if (report.difficultyCount[i] == 0) continue;
+            difficulty << i * kDifficultyBinMeters << ',' << report.difficultySum[i] / report.difficultyCount[i]
+                << ',' << report.difficultyCount[i] << '\n';
+        }
+
+        std::ofstream frames(directory / "frametimes.csv");
+        frames << "frame_ms,count\n";
+        for (int i = 0; i < kFrameTimeBins; ++i) {
+            frames << i << ',' << report.frameTimes[i] << '\n';
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <log directory> [--threads N] [--csv <output directory>]" << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path logDirectory = argv[1];
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::filesystem::path csvDirectory;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            threadCount = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        }
+        else if (arg == "--csv" && i + 1 < argc) {
+            csvDirectory = argv[++i];
+        }
+        else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<std::filesystem::path> files;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(logDirectory, error)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".bpt") {
+            files.push_back(entry.path());
+        }
+    }
+    if (error) {
+        std::cerr << "Cannot read " << logDirectory.string() << ": " << error.message() << std::endl;
+        return 1;
+    }
+    if (files.empty()) {
+        std::cerr << "No .bpt logs in " << logDirectory.string() << std::endl;
+        return 1;
+    }
+
+    // Reports are large; keep them on the heap, one per worker
+    threadCount = std::min<unsigned>(threadCount, static_cast<unsigned>(files.size()));
+    std::vector<std::unique_ptr<Report>> reports;
+    for (unsigned i = 0; i < threadCount; ++i) {
+        reports.push_back(std::make_unique<Report>());
+    }
+
+    std::atomic<std::size_t> nextFile{ 0 };
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers.emplace_back([&, i]() {
+            for (std::size_t index = nextFile++; index < files.size(); index = nextFile++) {
+                analyzeFile(files[index], *reports[i]);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Report total;
+    for (const auto& report : reports) {
+        total.merge(*report);
+    }
+
+    printReport(total);
+    if (!csvDirectory.empty()) {
+        writeCsv(total, csvDirectory);
+        std::cout << "\nCSV written to " << csvDirectory.string() << std::endl;
+    }
+    return 0;
+}